@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Throughput of the Brainfuck interpreter of examples/bf.h.
+
+Preprocesses each program with every given compiler, checks its output
+against a reference interpreter, and writes one CSV row per run:
+
+    compiler,program,instructions,preprocess_s,instructions_per_s
+
+Usage:
+    bench/bf_bench.py                       # gcc and clang, CSV to stdout
+    bench/bf_bench.py -c gcc -p hello loops -r 5
+    bench/bf_bench.py -f prog.bf            # any program without input
+
+`instructions` is the number of Brainfuck instructions executed by the
+reference interpreter, with `[` and `]` counted every time they are reached.
+`preprocess_s` is the best wall time of `--repeat` runs of `-E`.
+"""
+import argparse
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), os.pardir))
+
+COMPILERS = ("gcc", "clang")
+NAMES = {"+": "INC", "-": "DEC", ">": "NEXT", "<": "PREV", ".": "PUT",
+         ",": "GET", "[": "LOOP", "]": "END"}
+PROGRAMS = {
+    "hello": "++++++++[>++++[>++>+++>+++>+<<<<-]>+>+>->>+[<]<-]>>.>---.+++++++"
+             "..+++.>>.<-.<.+++.------.--------.>>+.>++.",
+    # 6 * 6 * 6 increments through three nested loops
+    "loops": "++++++[>++++++[>++++++[>+<-]<-]<-]>>>.",
+    # 40 cells counted down one by one, so the tape grows
+    "tape": "++++++++++[>++++<-]>[[>+<-]>-]<[<]>.",
+}
+
+
+def run_reference(src):
+    """Output bytes and number of executed instructions."""
+    code = [c for c in src if c in NAMES]
+    match, stack = {}, []
+    for i, c in enumerate(code):
+        if c == "[":
+            stack.append(i)
+        elif c == "]":
+            j = stack.pop()
+            match[i], match[j] = j, i
+    tape, ptr, pc, steps, out = {}, 0, 0, 0, []
+    while pc < len(code):
+        c = code[pc]
+        steps += 1
+        if c == "+":
+            tape[ptr] = (tape.get(ptr, 0) + 1) % 256
+        elif c == "-":
+            tape[ptr] = (tape.get(ptr, 0) - 1) % 256
+        elif c == ">":
+            ptr += 1
+        elif c == "<":
+            ptr -= 1
+        elif c == ".":
+            out.append(tape.get(ptr, 0))
+        elif c == ",":
+            tape[ptr] = 0
+        elif c == "[" and not tape.get(ptr, 0):
+            pc = match[pc]
+        elif c == "]" and tape.get(ptr, 0):
+            pc = match[pc]
+        pc += 1
+    return out, steps
+
+
+def source(src, level):
+    return ('#define CM_MAX_LEVEL %d\n#include "examples/bf.h"\n'
+            "BF(SEQ_NIL, %s)\n" % (level, ", ".join(
+                NAMES[c] for c in src if c in NAMES)))
+
+
+def preprocess(compiler, path, repeat):
+    best, out = None, None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        out = subprocess.run([compiler, "-E", "-P", "-I", ROOT, path],
+                             check=True, capture_output=True,
+                             text=True).stdout
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best, [int(x) for x in out.replace(",", " ").split()]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", help="CSV file (default: stdout)")
+    parser.add_argument("-c", "--compiler", nargs="+", default=COMPILERS)
+    parser.add_argument("-p", "--program", nargs="+", default=list(PROGRAMS),
+                        choices=list(PROGRAMS))
+    parser.add_argument("-f", "--file", nargs="+", default=[],
+                        help="Brainfuck source files")
+    parser.add_argument("-l", "--level", type=int, default=16,
+                        help="CM_MAX_LEVEL")
+    parser.add_argument("-r", "--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    programs = [(name, PROGRAMS[name]) for name in args.program]
+    for path in args.file:
+        with open(path) as f:
+            programs.append((os.path.basename(path), f.read()))
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(["compiler", "program", "instructions", "preprocess_s",
+                     "instructions_per_s"])
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for compiler in args.compiler:
+            if shutil.which(compiler) is None:
+                print("skipping %s: not found" % compiler, file=sys.stderr)
+                continue
+            for name, src in programs:
+                expected, steps = run_reference(src)
+                path = os.path.join(tmpdir, name + ".c")
+                with open(path, "w") as f:
+                    f.write(source(src, args.level))
+                elapsed, result = preprocess(compiler, path, args.repeat)
+                if result != expected:
+                    sys.exit("%s: %s: output %s, expected %s"
+                             % (compiler, name, result, expected))
+                writer.writerow([compiler, name, steps, "%.3f" % elapsed,
+                                 "%.0f" % (steps / elapsed)])
+                out.flush()
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
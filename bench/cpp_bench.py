@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Compile time and memory of continuation_machine.hpp against the macros.
+
+Counts `n` arguments one per iteration, with `CM` in C and with `cm::run` in
+C++20, compiles both with -fsyntax-only and writes one CSV row per build:
+
+    compiler,backend,iterations,wall_s,peak_rss_kb
+
+Usage:
+    bench/cpp_bench.py                      # gcc and clang, CSV to stdout
+    bench/cpp_bench.py -c gcc -n 100 1000 -r 5
+
+`wall_s` is the best of `--repeat` runs, `peak_rss_kb` the largest maximum
+resident set size of the compiler over those runs. Macros are run with
+CM_MAX_LEVEL=12, so that 10k iterations fit.
+"""
+import argparse
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), os.pardir))
+
+COMPILERS = {"gcc": ("gcc", "g++"), "clang": ("clang", "clang++")}
+ITERATIONS = (100, 1000, 10000)
+
+
+def source_macro(n):
+    return ("#define CM_MAX_LEVEL 12\n"
+            '#include "macro_helpers.h"\n'
+            "#define CM_COUNT(p, f, count, head, ...) \\\n"
+            "  (, IF(IS_EMPTY(__VA_ARGS__))(COUNT_DONE, f), "
+            "NARG_ADD(count, 0, 1), __VA_ARGS__)\n"
+            "#define CM_COUNT_DONE(p, f, count, ...) "
+            "CM_RETURN(p, f, (NARG_TO_NUMBER(count)))\n"
+            "_Static_assert(CM(COUNT, (0, 0, 0, 0, 0, 0), %s) == %d, \"\");\n"
+            % (", ".join(str(i) for i in range(n)), n))
+
+
+def source_constexpr(n):
+    return ('#include "continuation_machine.hpp"\n'
+            "constexpr cm::machine<int, int> count(int n, "
+            "std::span<const int> args) {\n"
+            "  if (args.empty()) return cm::ret(n);\n"
+            "  return cm::next(count, n + 1, args.subspan(1));\n"
+            "}\n"
+            "static_assert(cm::run(count, 0, %s) == %d);\n"
+            % (", ".join(str(i) for i in range(n)), n))
+
+
+BACKENDS = {
+    "macro": (source_macro, 0, ".c", ["-std=c11"]),
+    "constexpr": (source_constexpr, 1, ".cpp", ["-std=c++20"]),
+}
+
+
+def run_once(cmd):
+    """Runs `cmd`, returns (wall seconds, peak RSS in KB)."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd)
+    _, status, usage = os.wait4(proc.pid, 0)
+    wall = time.perf_counter() - start
+    if os.waitstatus_to_exitcode(status) != 0:
+        sys.exit("failed: " + " ".join(cmd))
+    return wall, usage.ru_maxrss
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", help="CSV file (default: stdout)")
+    parser.add_argument("-c", "--compiler", nargs="+", default=list(COMPILERS),
+                        choices=list(COMPILERS))
+    parser.add_argument("-b", "--backend", nargs="+", default=list(BACKENDS),
+                        choices=list(BACKENDS))
+    parser.add_argument("-n", "--iterations", nargs="+", type=int,
+                        default=ITERATIONS)
+    parser.add_argument("-r", "--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(["compiler", "backend", "iterations", "wall_s",
+                     "peak_rss_kb"])
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for compiler in args.compiler:
+            if shutil.which(COMPILERS[compiler][1]) is None:
+                print("skipping %s: not found" % compiler, file=sys.stderr)
+                continue
+            for backend in args.backend:
+                generate, driver, ext, flags = BACKENDS[backend]
+                for n in args.iterations:
+                    path = os.path.join(tmpdir, "%s_%d%s" % (backend, n, ext))
+                    with open(path, "w") as f:
+                        f.write(generate(n))
+                    cmd = [COMPILERS[compiler][driver], "-fsyntax-only",
+                           "-I", ROOT, path] + flags
+                    best, peak = None, 0
+                    for _ in range(args.repeat):
+                        wall, rss = run_once(cmd)
+                        best = wall if best is None else min(best, wall)
+                        peak = max(peak, rss)
+                    writer.writerow([compiler, backend, n, "%.3f" % best,
+                                     peak])
+                    out.flush()
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,85 @@
+/* CM_ENUM lookup by name against a linear scan of the name table.
+ *
+ * Build and run with, e.g.:
+ *   gcc -O2 -pthread -I. bench/enum_bench.c -o enum_bench && ./enum_bench
+ * Starts with lookups from several threads at once, while the hash table is
+ * being filled, then prints nanoseconds per lookup for both. Fails if any
+ * lookup returns a wrong value. */
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "cm_enum.h"
+
+#define THREADS 8
+#define ROUNDS 10
+#define LOOKUPS 1000000
+
+CM_ENUM(Keyword, AUTO, BREAK, CASE, CHAR, CONST, CONTINUE, DEFAULT, DO, DOUBLE,
+        ELSE, ENUM, EXTERN, FLOAT, FOR, GOTO, IF, INLINE, INT, LONG, REGISTER,
+        RESTRICT, RETURN, SHORT, SIGNED, SIZEOF, STATIC, STRUCT, SWITCH,
+        TYPEDEF, UNION, UNSIGNED, VOID, VOLATILE, WHILE)
+
+static int from_string_linear(const char *str, enum Keyword *value) {
+  for (size_t i = 0; i < Keyword_COUNT; i++)
+    if (strcmp(Keyword_names[i], str) == 0) {
+      *value = (enum Keyword)i;
+      return 1;
+    }
+  return 0;
+}
+
+static void *look_up_all(void *failed) {
+  for (int round = 0; round < 1000; round++)
+    for (size_t i = 0; i < Keyword_COUNT; i++) {
+      enum Keyword value;
+      if (!Keyword_from_string(Keyword_names[i], &value) ||
+          value != (enum Keyword)i)
+        *(int *)failed = 1;
+    }
+  return NULL;
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static double run(int (*from_string)(const char *, enum Keyword *),
+                  unsigned *sum) {
+  double best = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    double start = now();
+    for (int i = 0; i < LOOKUPS; i++) {
+      enum Keyword value = AUTO;
+      from_string(Keyword_names[(unsigned)i * 7 % Keyword_COUNT], &value);
+      *sum += value;
+    }
+    double elapsed = now() - start;
+    if (round == 0 || elapsed < best) best = elapsed;
+  }
+  return best * 1e9 / LOOKUPS;
+}
+
+int main(void) {
+  pthread_t threads[THREADS];
+  int failed[THREADS] = {0};
+  for (int i = 0; i < THREADS; i++)
+    pthread_create(&threads[i], NULL, look_up_all, &failed[i]);
+  for (int i = 0; i < THREADS; i++) {
+    pthread_join(threads[i], NULL);
+    if (failed[i]) {
+      printf("thread %d: wrong lookup\n", i);
+      return 1;
+    }
+  }
+
+  unsigned hashed = 0, linear = 0;
+  double t_hashed = run(Keyword_from_string, &hashed);
+  double t_linear = run(from_string_linear, &linear);
+  printf("names=%d hashed %.1f ns linear %.1f ns\n", (int)Keyword_COUNT,
+         t_hashed, t_linear);
+  return hashed != linear;
+}
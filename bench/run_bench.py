@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+"""Preprocessing-time benchmark for continuation_machine.h.
+
+Generates inputs for every workload at every iteration count and argument
+width, preprocesses them with every available preprocessor, and writes one
+CSV row per run:
+
+    compiler,max_level,ladder,workload,iterations,width,wall_s,peak_rss_kb,
+    out_tokens,status
+
+Usage:
+    bench/run_bench.py                      # everything, CSV to stdout
+    bench/run_bench.py -o bench.csv -c gcc -w cm -n 10 100
+    bench/run_bench.py --baseline old.csv   # fail on >20% slowdown
+    bench/run_bench.py -w exit -l 9 16      # compare ladder levels
+    bench/run_bench.py -w cm --ladder x2 x3 x4  # compare generator presets
+
+Preprocessors that are not installed are skipped. `wall_s` is the best of
+`--repeat` runs, `peak_rss_kb` is the largest maximum resident set size of the
+preprocessor process over those runs.
+"""
+import argparse
+import csv
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), os.pardir))
+
+sys.path.insert(0, os.path.join(ROOT, "tools"))
+import gen_ladder  # noqa: E402
+
+PREPROCESSORS = {
+    "gcc": ["gcc", "-E", "-P", "-std=c2x"],
+    "clang": ["clang", "-E", "-P", "-std=c2x"],
+    "tcc": ["tcc", "-E"],
+    "mcpp": ["mcpp", "-P", "-@compat"],
+}
+
+ITERATIONS = (10, 100, 1000, 2000)
+WIDTHS = (1, 8)
+MAX_LEVELS = (9,)
+
+# Matches C preprocessing tokens closely enough to count them.
+TOKEN = re.compile(r'"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\'|[A-Za-z_]\w*|'
+                   r'\.?\d(?:[eEpP][+-]|[\w.])*|\S')
+
+
+def arg(i, width):
+    """One argument made of `width` tokens."""
+    return " ".join("a%d_%d" % (i, j) for j in range(width))
+
+
+def workload_cm(n, width):
+    """CM dropping one argument per iteration, with a constant-size state."""
+    args = ", ".join(arg(i, width) for i in range(n))
+    return ("#define CM_DROP(p, f, state, head, ...) \\\n"
+            "  (, IF(IS_EMPTY(__VA_ARGS__))(RETURN, f), state, __VA_ARGS__)\n"
+            "CM(DROP, (done), %s)\n" % args)
+
+
+def workload_exit(n, width):
+    """Like `cm`, but returns `1000 * width` tokens from the last iteration.
+
+    Measures what the pending ladder frames cost after termination, which
+    shall not depend on CM_MAX_LEVEL.
+    """
+    args = ", ".join(arg(i, width) for i in range(n))
+    result = " ".join("r%d" % i for i in range(1000 * width))
+    return ("#define CM_DROP(p, f, state, head, ...) \\\n"
+            "  (, IF(IS_EMPTY(__VA_ARGS__))(DONE, f), state, __VA_ARGS__)\n"
+            "#define CM_DONE(p, f, state, ...) CM_RETURN(, f, (%s))\n"
+            "CM(DROP, (), %s)\n" % (result, args))
+
+
+def workload_emit(n, width):
+    """CM emitting `width` tokens per iteration, with a constant-size state."""
+    args = ", ".join(arg(i, width) for i in range(n))
+    return ("#define CM_DECLARE(p, f, state, head, ...) \\\n"
+            "  CM_EMIT((int head;), , IF(IS_EMPTY(__VA_ARGS__))(EXIT, f), "
+            "state, __VA_ARGS__)\n"
+            "CM(DECLARE, CM_NO_STATE, %s)\n" % args)
+
+
+def workload_many(n, width):
+    """16 independent `cm` machines, one after another."""
+    args = ", ".join(arg(i, width) for i in range(n))
+    return ("#define CM_DROP(p, f, state, head, ...) \\\n"
+            "  (, IF(IS_EMPTY(__VA_ARGS__))(RETURN, f), state, __VA_ARGS__)\n" +
+            "".join("CM(DROP, (r%d), %s)\n" % (i, args) for i in range(16)))
+
+
+def workload_foreach(n, width):
+    """FOREACH over `n` arguments, accumulating every result in the state."""
+    args = ", ".join(arg(i, width) for i in range(n))
+    return "FOREACH(PARENTHESIZE, %s)\n" % args
+
+
+def workload_foreach_i(n, width):
+    """FOREACH_I over `n` arguments, emitting results out of the machine."""
+    args = ", ".join(arg(i, width) for i in range(n))
+    return ("#define F(ctx, i, x) (i: x)\n"
+            "FOREACH_I(F, , EMPTY, %s)\n" % args)
+
+
+def workload_foreach_rows(n, width):
+    """FOREACH_ROWS over `n` rows of `width` columns, projecting one column."""
+    rows = ", ".join("(%s)" % ", ".join("c%d_%d" % (i, j) for j in range(width))
+                     for i in range(n))
+    return ("#define F(row) [COL(0, row)] = COL(%d, row),\n"
+            "FOREACH_ROWS(F, %s)\n" % (min(width, 16) - 1, rows))
+
+
+def workload_pp_narg(n, width):
+    """`n` independent PP_NARG calls on `width` arguments each."""
+    width = min(width, 63)
+    args = ", ".join("x%d" % j for j in range(width))
+    return "".join("PP_NARG(%s)\n" % args for _ in range(n))
+
+
+def workload_n_args(n, width):
+    """N_ARGS_LONG on `n` arguments."""
+    args = ", ".join(arg(i, width) for i in range(n))
+    return "N_ARGS_LONG(%s)\n" % args
+
+
+WORKLOADS = {
+    "cm": workload_cm,
+    "exit": workload_exit,
+    "emit": workload_emit,
+    "many": workload_many,
+    "foreach": workload_foreach,
+    "foreach_i": workload_foreach_i,
+    "foreach_rows": workload_foreach_rows,
+    "pp_narg": workload_pp_narg,
+    "n_args": workload_n_args,
+}
+
+
+def source(workload, n, width):
+    return ('#include "continuation_machine.h"\n' +
+            WORKLOADS[workload](n, width))
+
+
+def run_once(cmd):
+    """Runs `cmd`, returns (wall seconds, peak RSS in KB, stdout, exit code)."""
+    with tempfile.TemporaryFile() as out:
+        start = time.perf_counter()
+        proc = subprocess.Popen(cmd, stdout=out, stderr=subprocess.DEVNULL)
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall = time.perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status)
+        out.seek(0)
+        text = out.read().decode(errors="replace")
+    return wall, usage.ru_maxrss, text, proc.returncode
+
+
+def bench(compiler, level, ladder, workload, n, width, repeat, tmpdir):
+    path = os.path.join(tmpdir, "%s_%d_%d.c" % (workload, n, width))
+    with open(path, "w") as f:
+        f.write(source(workload, n, width))
+    cmd = PREPROCESSORS[compiler] + ["-I", ROOT]
+    if ladder == "tuned":
+        cmd.append("-DCM_LADDER_TUNED")
+    else:
+        cmd.append("-DCM_MAX_LEVEL=%d" % level)
+    if ladder and ladder != "tuned":
+        header = gen_ladder.header_name(*gen_ladder.PRESETS[ladder])
+        cmd.append('-DCM_LADDER_HEADER="ladder/%s"' % header)
+    cmd.append(path)
+
+    best, peak, tokens, status = None, 0, 0, "ok"
+    for _ in range(repeat):
+        wall, rss, text, code = run_once(cmd)
+        if code != 0:
+            status = "error"
+            break
+        best = wall if best is None else min(best, wall)
+        peak = max(peak, rss)
+        tokens = len(TOKEN.findall(text))
+    return {
+        "compiler": compiler,
+        "max_level": level,
+        "ladder": ladder,
+        "workload": workload,
+        "iterations": n,
+        "width": width,
+        "wall_s": "%.4f" % best if best is not None else "",
+        "peak_rss_kb": peak,
+        "out_tokens": tokens,
+        "status": status,
+    }
+
+
+def key(row):
+    return (row["compiler"], str(row.get("max_level", 9)),
+            row.get("ladder", ""), row["workload"], str(row["iterations"]),
+            str(row["width"]))
+
+
+def check_baseline(rows, baseline, tolerance):
+    """Returns a list of regressions of `rows` relative to `baseline` file."""
+    with open(baseline, newline="") as f:
+        old = {key(r): r for r in csv.DictReader(f)}
+    regressions = []
+    for row in rows:
+        prev = old.get(key(row))
+        if not prev or not prev["wall_s"] or not row["wall_s"]:
+            continue
+        if float(row["wall_s"]) > float(prev["wall_s"]) * (1 + tolerance):
+            regressions.append("%s: %ss -> %ss" % (
+                "/".join(k for k in key(row) if k), prev["wall_s"],
+                row["wall_s"]))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", help="CSV file (default: stdout)")
+    parser.add_argument("-c", "--compiler", nargs="+",
+                        choices=sorted(PREPROCESSORS), default=None)
+    parser.add_argument("-w", "--workload", nargs="+",
+                        choices=sorted(WORKLOADS), default=None)
+    parser.add_argument("-n", "--iterations", nargs="+", type=int,
+                        default=ITERATIONS)
+    parser.add_argument("--width", nargs="+", type=int, default=WIDTHS)
+    parser.add_argument("-l", "--max-level", nargs="+", type=int,
+                        default=MAX_LEVELS, help="values of CM_MAX_LEVEL")
+    parser.add_argument("--ladder", nargs="+",
+                        choices=sorted(gen_ladder.PRESETS) + ["tuned"],
+                        help="tools/gen_ladder.py presets (overrides -l), or "
+                        "tuned for the one selected by the compiler with "
+                        "CM_LADDER_TUNED")
+    parser.add_argument("-r", "--repeat", type=int, default=3)
+    parser.add_argument("--baseline", help="CSV from an earlier run")
+    parser.add_argument("--tolerance", type=float, default=0.2,
+                        help="allowed relative slowdown against --baseline")
+    args = parser.parse_args()
+
+    compilers = [c for c in (args.compiler or PREPROCESSORS)
+                 if shutil.which(PREPROCESSORS[c][0])]
+    if not compilers:
+        parser.error("none of the requested preprocessors is installed")
+
+    if args.ladder:
+        configs = [(gen_ladder.PRESETS[name][0] if name != "tuned" else 0,
+                    name) for name in args.ladder]
+    else:
+        configs = [(level, "") for level in args.max_level]
+
+    fields = ["compiler", "max_level", "ladder", "workload", "iterations", "width",
+              "wall_s", "peak_rss_kb", "out_tokens", "status"]
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    writer = csv.DictWriter(out, fieldnames=fields)
+    writer.writeheader()
+
+    rows = []
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for compiler in compilers:
+            for level, ladder in configs:
+                for workload in args.workload or WORKLOADS:
+                    for n in args.iterations:
+                        for width in args.width:
+                            row = bench(compiler, level, ladder, workload, n,
+                                        width, args.repeat, tmpdir)
+                            writer.writerow(row)
+                            out.flush()
+                            rows.append(row)
+    if out is not sys.stdout:
+        out.close()
+
+    if args.baseline:
+        regressions = check_baseline(rows, args.baseline, args.tolerance)
+        for r in regressions:
+            print("regression: " + r, file=sys.stderr)
+        return 1 if regressions else 0
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
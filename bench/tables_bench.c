@@ -0,0 +1,43 @@
+/* Lookup tables from cm_tables.h against the same tables computed at startup.
+ *
+ * Built twice by bench/tables_bench.py: as is, the tables are initializers
+ * generated by the preprocessor; with -DTABLES_RUNTIME, they are filled by
+ * init_tables() before main() uses them. Prints a checksum of all tables, so
+ * that neither build can drop them. */
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef TABLES_RUNTIME
+#include <math.h>
+
+static uint8_t popcount8[256];
+static uint32_t crc32[256];
+static int16_t sin_q15[256];
+
+static void init_tables(void) {
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; k++) c = c & 1 ? (c >> 1) ^ 0xEDB88320u : c >> 1;
+    crc32[i] = c;
+    popcount8[i] = (uint8_t)((i & 1) + popcount8[i / 2]);
+    sin_q15[i] = (int16_t)lround(sin(2 * M_PI * i / 256) * 32767);
+  }
+}
+#else
+#include "cm_tables.h"
+
+static const uint8_t popcount8[256] = {TABLE_POPCOUNT8()};
+static const uint32_t crc32[256] = {TABLE_CRC32()};
+static const int16_t sin_q15[256] = {TABLE_SIN_Q15()};
+
+static void init_tables(void) {}
+#endif
+
+int main(void) {
+  uint32_t sum = 0;
+  init_tables();
+  for (int i = 0; i < 256; i++)
+    sum = sum * 31 + popcount8[i] + crc32[i] + (uint16_t)sin_q15[i];
+  printf("%08x\n", (unsigned)sum);
+  return 0;
+}
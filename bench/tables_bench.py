@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Startup time and binary size of cm_tables.h against runtime initialization.
+
+Builds bench/tables_bench.c with the tables generated by the preprocessor and
+with -DTABLES_RUNTIME, where they are computed at startup, and writes one CSV
+row per build:
+
+    compiler,variant,build_s,text_bytes,data_bytes,run_us,checksum
+
+Usage:
+    bench/tables_bench.py                   # gcc and clang, CSV to stdout
+    bench/tables_bench.py -c gcc -O O0 O2 -n 1000
+
+`build_s` is the wall time of one build, `run_us` the best mean process run
+time over `--repeat` batches of `--runs` runs, so that it includes loading the
+tables. The checksums differ where the preprocessed sine table is off by one.
+"""
+import argparse
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), os.pardir))
+SOURCE = os.path.join(ROOT, "bench", "tables_bench.c")
+
+COMPILERS = ("gcc", "clang")
+VARIANTS = {
+    "preprocessed": [],
+    "runtime": ["-DTABLES_RUNTIME"],
+}
+
+
+def build(compiler, opt, variant, tmpdir):
+    exe = os.path.join(tmpdir, "%s_%s_%s" % (compiler, opt, variant))
+    cmd = [compiler, "-std=gnu11", "-" + opt, "-I", ROOT, SOURCE, "-o", exe,
+           "-lm"] + VARIANTS[variant]
+    start = time.perf_counter()
+    subprocess.run(cmd, check=True)
+    return exe, time.perf_counter() - start
+
+
+def section_sizes(exe):
+    """`text` and `data + bss` as reported by size(1)."""
+    out = subprocess.run(["size", exe], check=True, capture_output=True,
+                         text=True).stdout.splitlines()[1].split()
+    return int(out[0]), int(out[1]) + int(out[2])
+
+
+def run_time(exe, runs, repeat):
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        for _ in range(runs):
+            subprocess.run([exe], check=True, stdout=subprocess.DEVNULL)
+        mean = (time.perf_counter() - start) / runs
+        best = mean if best is None else min(best, mean)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", help="CSV file (default: stdout)")
+    parser.add_argument("-c", "--compiler", nargs="+", default=COMPILERS)
+    parser.add_argument("-O", "--opt", nargs="+", default=["O2"],
+                        help="optimization levels, without the dash")
+    parser.add_argument("-n", "--runs", type=int, default=200)
+    parser.add_argument("-r", "--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(["compiler", "variant", "build_s", "text_bytes",
+                     "data_bytes", "run_us", "checksum"])
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for compiler in args.compiler:
+            if shutil.which(compiler) is None:
+                print("skipping %s: not found" % compiler, file=sys.stderr)
+                continue
+            for opt in args.opt:
+                for variant in VARIANTS:
+                    exe, build_s = build(compiler, opt, variant, tmpdir)
+                    text, data = section_sizes(exe)
+                    checksum = subprocess.run(
+                        [exe], check=True, capture_output=True,
+                        text=True).stdout.strip()
+                    run_s = run_time(exe, args.runs, args.repeat)
+                    writer.writerow(["%s-%s" % (compiler, opt), variant,
+                                     "%.3f" % build_s, text, data,
+                                     "%.1f" % (run_s * 1e6), checksum])
+                    out.flush()
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+/* CM_UNROLL_LOOP, CM_UNROLL_DUFF and CM_LANES against plain loops.
+ *
+ * Build and run with, e.g.:
+ *   gcc -O2 -I. bench/unroll_bench.c -o unroll_bench && ./unroll_bench
+ * Prints nanoseconds per block (checksum of 64 bytes, copy of 1000 ints,
+ * rotation of 4 lanes) for both, and fails if their results differ. Lanes
+ * need __builtin_shufflevector (GCC 12, Clang). */
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "cm_unroll.h"
+
+#define BLOCKS 4096
+#define COPY 1000
+#define ROUNDS 10
+
+typedef int32_t v4si __attribute__((vector_size(16)));
+
+#define ROTATE_LANE(i) (((i) + 1) % 4)
+
+static uint32_t checksum_unrolled(const uint8_t *block) {
+  uint32_t sum = 0;
+  CM_UNROLL_LOOP(64, i, sum += (uint32_t)block[i] << (i % 4 * 8);)
+  return sum;
+}
+
+static uint32_t checksum_loop(const uint8_t *block) {
+  uint32_t sum = 0;
+  for (int i = 0; i < 64; i++) sum += (uint32_t)block[i] << (i % 4 * 8);
+  return sum;
+}
+
+static void copy_duff(int *to, const int *from, size_t count) {
+  CM_UNROLL_DUFF(8, count, *to++ = *from++;)
+}
+
+static void copy_loop(int *to, const int *from, size_t count) {
+  for (size_t i = 0; i < count; i++) to[i] = from[i];
+}
+
+static v4si rotate_lanes(v4si v) {
+  return __builtin_shufflevector(v, v, CM_LANES(4, ROTATE_LANE));
+}
+
+static v4si rotate_loop(v4si v) {
+  v4si r;
+  for (int i = 0; i < 4; i++) r[i] = v[(i + 1) % 4];
+  return r;
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint8_t blocks[BLOCKS][64];
+static int from[COPY + 7], to[COPY + 7];
+static v4si lanes[BLOCKS];
+
+static double time_checksum(uint32_t (*checksum)(const uint8_t *),
+                            uint32_t *result) {
+  double best = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    double start = now();
+    uint32_t sum = 0;
+    for (int i = 0; i < BLOCKS; i++) sum ^= checksum(blocks[i]);
+    double elapsed = now() - start;
+    *result = sum;
+    if (round == 0 || elapsed < best) best = elapsed;
+  }
+  return best * 1e9 / BLOCKS;
+}
+
+static double time_copy(void (*copy)(int *, const int *, size_t),
+                        uint32_t *result) {
+  double best = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    double start = now();
+    /* counts that leave every remainder of the device */
+    for (int i = 0; i < BLOCKS / 64; i++) copy(to, from, COPY - i % 8);
+    double elapsed = now() - start;
+    *result = (uint32_t)to[COPY - 1];
+    if (round == 0 || elapsed < best) best = elapsed;
+  }
+  return best * 1e9 / (BLOCKS / 64);
+}
+
+static double time_rotate(v4si (*rotate)(v4si), uint32_t *result) {
+  double best = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    double start = now();
+    v4si acc = {0};
+    for (int i = 0; i < BLOCKS; i++) acc ^= rotate(lanes[i]);
+    double elapsed = now() - start;
+    *result = 0;
+    for (int j = 0; j < 4; j++) *result ^= (uint32_t)acc[j] << (j * 8);
+    if (round == 0 || elapsed < best) best = elapsed;
+  }
+  return best * 1e9 / BLOCKS;
+}
+
+int main(void) {
+  uint32_t seed = 1;
+  for (int i = 0; i < BLOCKS; i++)
+    for (int j = 0; j < 64; j++)
+      blocks[i][j] = (uint8_t)((seed = seed * 1103515245u + 12345u) >> 24);
+  for (int i = 0; i < COPY; i++) from[i] = i * 7;
+  for (int i = 0; i < BLOCKS; i++)
+    for (int j = 0; j < 4; j++) lanes[i][j] = (int32_t)(i * 4 + j);
+
+  uint32_t r1, r2, r3, r4, r5, r6;
+  double checksum_cm = time_checksum(checksum_unrolled, &r1);
+  double checksum_plain = time_checksum(checksum_loop, &r2);
+  double copy_cm = time_copy(copy_duff, &r3);
+  double copy_plain = time_copy(copy_loop, &r4);
+  double rotate_cm = time_rotate(rotate_lanes, &r5);
+  double rotate_plain = time_rotate(rotate_loop, &r6);
+  printf("checksum unrolled %.1f ns loop %.1f ns\n", checksum_cm,
+         checksum_plain);
+  printf("copy duff %.1f ns loop %.1f ns\n", copy_cm, copy_plain);
+  printf("rotate lanes %.1f ns loop %.1f ns\n", rotate_cm, rotate_plain);
+  return r1 != r2 || r3 != r4 || r5 != r6;
+}
@@ -0,0 +1,306 @@
+/**
+ * @file cm_arith.h
+ * @brief Bounded-width decimal arithmetic for the preprocessor.
+ *
+ * @section arith_usage Usage
+ * Numbers are tuples of `ARITH_WIDTH` (8) decimal digits, most significant
+ * first. Build them with `ARITH`, and turn them into a decimal literal with
+ * `ARITH_TO_NUMBER`. Example:
+ *
+ * @code
+ * #include "cm_arith.h"
+ *
+ * ARITH_TO_NUMBER(ARITH_MUL(ARITH(1, 2), ARITH(3, 4)))   // expands to 408
+ * ARITH_TO_NUMBER(CM(ADD, ARITH(1), ARITH(2), ARITH(3))) // expands to 6
+ * ARITH_LT(ARITH(9), ARITH(1, 0))                        // expands to 1
+ * @endcode
+ *
+ * Operations (all results are numbers, except for comparisons, which expand to
+ * `0` or `1`):
+ * - `ARITH_ADD(a, b)`, `ARITH_SUB(a, b)`, `ARITH_MUL(a, b)`: modulo
+ *   `10^ARITH_WIDTH`, so `ARITH_SUB` wraps around below zero.
+ * - `ARITH_DIVMOD(a, b)`: expands to `q, r`, `ARITH_DIV(a, b)` and
+ *   `ARITH_MOD(a, b)` to either of them, for any `b` but zero.
+ * - `ARITH_INC(a)`, `ARITH_DEC(a)`.
+ * - `ARITH_MUL_FIXED(a, b)`: `a * b / 10^6`, i.e. product of numbers with 6
+ *   fractional digits. Rounds down, `9 * a` shall fit into `ARITH_WIDTH`.
+ * - `ARITH_SHIFT(a)`, `ARITH_UNSHIFT(a)`: `a * 10`, `a / 10`.
+ * - `ARITH_LT(a, b)`, `ARITH_EQ(a, b)`, `ARITH_IS_ZERO(a)`.
+ *
+ * Each operation works on digits rather than on a unary representation of the
+ * value, so its cost only depends on `ARITH_WIDTH`: `O(w)` for `ARITH_ADD`,
+ * `ARITH_SUB` and comparisons, `O(w^2)` for `ARITH_MUL` and `ARITH_DIVMOD`.
+ * None of them uses `CM`, so they can be used inside transition functions.
+ *
+ * The same operations are also available as transition functions, which fold
+ * a list of numbers the way Lisp's `+`, `-`, `*`, `<` and `=` do:
+ * - `CM(ADD, a, b, c...)`, `CM(SUB, ...)`, `CM(MUL, ...)`: `a + b + c...`,
+ *   etc.
+ * - `CM(DIVMOD, a, b, c...)`: `a / b / c...`, expands to `q, r`, where `r` is
+ *   the remainder of the last division.
+ * - `CM(LT, a, b, c...)`, `CM(EQ, a, b, c...)`: `1` if every number is less
+ *   than (equal to) the next one. Stops at the first pair that is not.
+ *
+ * With a single number, `CM(ADD, a)`, `CM(SUB, a)` and `CM(MUL, a)` expand to
+ * `a`, `CM(DIVMOD, a)` to `a, ARITH_ZERO`, and comparisons to `1`.
+ *
+ * `tools/test_cm_arith.py` checks the operations against Python's integers.
+ *
+ * @note Since `CM` cannot be invoked from within another `CM`'s transition
+ * function, use `ARITH_*` macros there.
+ */
+#pragma once
+#include "continuation_machine.h"
+
+#define ARITH_WIDTH 8
+
+/* pads digits (most significant first) with zeros to ARITH_WIDTH */
+#define ARITH(...) (CAT(ARITH_PAD_, PP_NARG(__VA_ARGS__)) __VA_ARGS__)
+#define ARITH_TO_NUMBER(a) DIGITS_TO_NUMBER a
+
+#define ARITH_ZERO (0, 0, 0, 0, 0, 0, 0, 0)
+#define ARITH_ONE (0, 0, 0, 0, 0, 0, 0, 1)
+
+/* clang-format off */
+#define ARITH_PAD_1 0, 0, 0, 0, 0, 0, 0,
+#define ARITH_PAD_2 0, 0, 0, 0, 0, 0,
+#define ARITH_PAD_3 0, 0, 0, 0, 0,
+#define ARITH_PAD_4 0, 0, 0, 0,
+#define ARITH_PAD_5 0, 0, 0,
+#define ARITH_PAD_6 0, 0,
+#define ARITH_PAD_7 0,
+#define ARITH_PAD_8
+/* clang-format on */
+
+/* addition and subtraction: folds digit pairs, least significant first, into
+ * an accumulator (carry, digits...) */
+#define ARITH_ADD(a, b)                                                        \
+  ARITH_DIGITS(ARITH_RIPPLE(ARITH_ADD_DIGIT, (0), ARITH_ZIP(a, b)))
+#define ARITH_SUB(a, b)                                                        \
+  ARITH_DIGITS(ARITH_RIPPLE(ARITH_SUB_DIGIT, (1), ARITH_ZIP(a, b)))
+
+#define ARITH_INC(a) ARITH_ADD(a, ARITH_ONE)
+#define ARITH_DEC(a) ARITH_SUB(a, ARITH_ONE)
+
+/* a - b borrows (leaves no carry) iff a < b */
+#define ARITH_LT(a, b)                                                         \
+  COMPL(ARITH_CARRY(ARITH_RIPPLE(ARITH_SUB_DIGIT, (1), ARITH_ZIP(a, b))))
+#define ARITH_EQ(a, b) ARITH_IS_ZERO(ARITH_SUB(a, b))
+#define ARITH_IS_ZERO(a) CHECK(CAT(ARITH_IS_ZERO_, DIGITS_CAT a))
+#define ARITH_IS_ZERO_00000000 ~, 1,
+
+#define ARITH_RIPPLE(op, acc, pairs) ARITH_RIPPLE_(op, acc, EXPAND pairs)
+#define ARITH_RIPPLE_(...) ARITH_FOLD(__VA_ARGS__)
+#define ARITH_FOLD(op, acc, p0, p1, p2, p3, p4, p5, p6, p7)                    \
+  op(op(op(op(op(op(op(op(acc, p0), p1), p2), p3), p4), p5), p6), p7)
+
+#define ARITH_ADD_DIGIT(acc, pair)                                             \
+  (ARITH_DIGIT_ADD(EXPAND pair, FIRST_ARG acc) ARITH_COMMA_REST acc)
+#define ARITH_SUB_DIGIT(acc, pair)                                             \
+  (ARITH_DIGIT_SUB(EXPAND pair, FIRST_ARG acc) ARITH_COMMA_REST acc)
+
+#define ARITH_DIGIT_ADD(...) DIGIT_ADD(__VA_ARGS__)
+/* a - b with carry c (not borrow) is a + (9 - b) + c */
+#define ARITH_DIGIT_SUB(...) ARITH_DIGIT_SUB_(__VA_ARGS__)
+#define ARITH_DIGIT_SUB_(a, b, c) DIGIT_ADD(a, CAT(ARITH_NINES_, b), c)
+
+#define ARITH_COMMA_REST(x, ...) __VA_OPT__(, ) __VA_ARGS__
+#define ARITH_CARRY(acc) FIRST_ARG acc
+#define ARITH_DIGITS(acc) ARITH_DROP_CARRY acc
+#define ARITH_DROP_CARRY(c, ...) (__VA_ARGS__)
+
+/* pairs corresponding digits of a and b, least significant first */
+#define ARITH_ZIP(a, b) (ARITH_ZIP_(EXPAND a, EXPAND b))
+#define ARITH_ZIP_(...) ARITH_ZIP__(__VA_ARGS__)
+#define ARITH_ZIP__(a7, a6, a5, a4, a3, a2, a1, a0, b7, b6, b5, b4, b3, b2, b1,\
+                    b0)                                                        \
+  (a0, b0), (a1, b1), (a2, b2), (a3, b3), (a4, b4), (a5, b5), (a6, b6), (a7, b7)
+
+/* clang-format off */
+#define ARITH_NINES_0 9
+#define ARITH_NINES_1 8
+#define ARITH_NINES_2 7
+#define ARITH_NINES_3 6
+#define ARITH_NINES_4 5
+#define ARITH_NINES_5 4
+#define ARITH_NINES_6 3
+#define ARITH_NINES_7 2
+#define ARITH_NINES_8 1
+#define ARITH_NINES_9 0
+/* clang-format on */
+
+/* multiplication and division: both first compute (0, a, 2a, ... 9a) of one
+ * operand, then process the digits of the other one, most significant first */
+#define ARITH_MUL(a, b)                                                        \
+  ARITH_MUL_(ARITH_MULTIPLES(a), EXPAND b)
+#define ARITH_MUL_(...) ARITH_MUL__(__VA_ARGS__)
+#define ARITH_MUL__(m, d7, d6, d5, d4, d3, d2, d1, d0)                         \
+  ARITH_MUL_DIGIT(m, ARITH_MUL_DIGIT(m, ARITH_MUL_DIGIT(m, ARITH_MUL_DIGIT(    \
+      m, ARITH_MUL_DIGIT(m, ARITH_MUL_DIGIT(m, ARITH_MUL_DIGIT(m,              \
+      ARITH_MUL_DIGIT(m, ARITH_ZERO, d7), d6), d5), d4), d3), d2), d1), d0)
+/* acc * 10 + d * a */
+#define ARITH_MUL_DIGIT(m, acc, d)                                             \
+  ARITH_ADD(ARITH_SHIFT(acc), ARITH_PICK(d, m))
+
+/* integer digits of b are processed as in ARITH_MUL, fractional ones least
+ * significant first, dividing by 10 after each, so that no digit of a * b
+ * beyond ARITH_WIDTH is ever needed */
+#define ARITH_MUL_FIXED(a, b) ARITH_MUL_FIXED_(ARITH_MULTIPLES(a), EXPAND b)
+#define ARITH_MUL_FIXED_(...) ARITH_MUL_FIXED__(__VA_ARGS__)
+#define ARITH_MUL_FIXED__(m, d7, d6, d5, d4, d3, d2, d1, d0)                   \
+  ARITH_ADD(                                                                   \
+      ARITH_MUL_DIGIT(m, ARITH_MUL_DIGIT(m, ARITH_ZERO, d7), d6),              \
+      ARITH_MUL_FRACTION_DIGIT(m, ARITH_MUL_FRACTION_DIGIT(                    \
+          m, ARITH_MUL_FRACTION_DIGIT(m, ARITH_MUL_FRACTION_DIGIT(             \
+          m, ARITH_MUL_FRACTION_DIGIT(m, ARITH_MUL_FRACTION_DIGIT(             \
+          m, ARITH_ZERO, d0), d1), d2), d3), d4), d5))
+/* (acc + d * a) / 10 */
+#define ARITH_MUL_FRACTION_DIGIT(m, acc, d)                                    \
+  ARITH_UNSHIFT(ARITH_ADD(acc, ARITH_PICK(d, m)))
+
+#define ARITH_DIV(a, b) ARITH_QUOTIENT(ARITH_DIVMOD(a, b))
+#define ARITH_MOD(a, b) ARITH_REMAINDER(ARITH_DIVMOD(a, b))
+#define ARITH_QUOTIENT(...) ARITH_QUOTIENT_(__VA_ARGS__)
+#define ARITH_QUOTIENT_(q, r) q
+#define ARITH_REMAINDER(...) ARITH_SECOND_(__VA_ARGS__)
+
+#define ARITH_DIVMOD(a, b)                                                     \
+  ARITH_DIVMOD_(ARITH_DIV_MULTIPLES(b), EXPAND a)
+#define ARITH_DIVMOD_(...) ARITH_DIVMOD__(__VA_ARGS__)
+#define ARITH_DIVMOD__(m, d7, d6, d5, d4, d3, d2, d1, d0)                      \
+  ARITH_DIVMOD_END(ARITH_DIV_DIGIT(m, d0, ARITH_DIV_DIGIT(m, d1,               \
+      ARITH_DIV_DIGIT(m, d2, ARITH_DIV_DIGIT(m, d3, ARITH_DIV_DIGIT(m, d4,     \
+      ARITH_DIV_DIGIT(m, d5, ARITH_DIV_DIGIT(m, d6, ARITH_DIV_DIGIT(m, d7,     \
+      (ARITH_ZERO, ARITH_ZERO))))))))))
+#define ARITH_DIVMOD_END(acc) EXPAND acc
+/* acc is (q, r): with r' = r * 10 + d, the next digit of q is the number of
+ * multiples of b (1b ... 9b) not greater than r' */
+#define ARITH_DIV_DIGIT(m, d, acc) ARITH_DIV_DIGIT_(m, d, EXPAND acc)
+#define ARITH_DIV_DIGIT_(...) ARITH_DIV_DIGIT__(__VA_ARGS__)
+#define ARITH_DIV_DIGIT__(m, d, q, r)                                          \
+  ARITH_DIV_SUBTRACT(m, q, ARITH_SHIFT_IN(r, d))
+#define ARITH_DIV_SUBTRACT(m, q, r)                                            \
+  ARITH_DIV_SUBTRACT_(m, q, r, ARITH_DIV_COUNT(m, r))
+#define ARITH_DIV_SUBTRACT_(m, q, r, n)                                        \
+  (ARITH_SHIFT_IN(q, n), ARITH_SUB(r, ARITH_DIGITS(ARITH_PICK(n, m))))
+#define ARITH_DIV_COUNT(m, r) ARITH_DIV_COUNT_(r, EXPAND m)
+#define ARITH_DIV_COUNT_(...) ARITH_DIV_COUNT__(__VA_ARGS__)
+#define ARITH_DIV_COUNT__(r, m0, m1, m2, m3, m4, m5, m6, m7, m8, m9)           \
+  ARITH_SECOND(CAT(                                                            \
+      DIGIT_SUM_,                                                              \
+      PP_NARG(~ ARITH_NOT_GREATER(m1, r) ARITH_NOT_GREATER(m2, r)              \
+                  ARITH_NOT_GREATER(m3, r) ARITH_NOT_GREATER(m4, r)            \
+                      ARITH_NOT_GREATER(m5, r) ARITH_NOT_GREATER(m6, r)        \
+                          ARITH_NOT_GREATER(m7, r) ARITH_NOT_GREATER(m8, r)    \
+                              ARITH_NOT_GREATER(m9, r))))
+/* `, ~` if a <= b, used to count in unary with PP_NARG; a is a multiple of
+ * ARITH_DIV_MULTIPLES, never <= b if it overflows */
+#define ARITH_NOT_GREATER(a, b)                                                \
+  IIF(FIRST_ARG a)(DISCARD, ARITH_NOT_GREATER_)(ARITH_DIGITS(a), b)
+#define ARITH_NOT_GREATER_(a, b) CAT(DIGIT_UNARY_, COMPL(ARITH_LT(b, a)))
+#define ARITH_SECOND(...) ARITH_SECOND_(__VA_ARGS__)
+#define ARITH_SECOND_(a, b) b
+
+/* (0, a, 2a, ... 9a) */
+#define ARITH_MULTIPLES(a) ARITH_MULTIPLES_2(a, ARITH_ADD(a, a))
+#define ARITH_MULTIPLES_2(a, a2) ARITH_MULTIPLES_3(a, a2, ARITH_ADD(a2, a))
+#define ARITH_MULTIPLES_3(a, a2, a3)                                           \
+  ARITH_MULTIPLES_4(a, a2, a3, ARITH_ADD(a2, a2))
+#define ARITH_MULTIPLES_4(a, a2, a3, a4)                                       \
+  ARITH_MULTIPLES_8(a, a2, a3, a4, ARITH_ADD(a4, a4))
+#define ARITH_MULTIPLES_8(a, a2, a3, a4, a8)                                   \
+  (ARITH_ZERO, a, a2, a3, a4, ARITH_ADD(a4, a), ARITH_ADD(a4, a2),             \
+   ARITH_ADD(a4, a3), a8, ARITH_ADD(a8, a))
+
+/* the same for division, with an overflow flag before the digits of each
+ * multiple: a remainder has at most ARITH_WIDTH digits, so an overflowing
+ * multiple is greater than any of them, while its wrapped digits may not be */
+#define ARITH_DIV_MULTIPLES(a) ARITH_DIV_MULTIPLES_(ARITH_WIDE(a))
+#define ARITH_DIV_MULTIPLES_(a)                                                \
+  ARITH_DIV_MULTIPLES_2(a, ARITH_WIDE_ADD(a, a))
+#define ARITH_DIV_MULTIPLES_2(a, a2)                                           \
+  ARITH_DIV_MULTIPLES_3(a, a2, ARITH_WIDE_ADD(a2, a))
+#define ARITH_DIV_MULTIPLES_3(a, a2, a3)                                       \
+  ARITH_DIV_MULTIPLES_4(a, a2, a3, ARITH_WIDE_ADD(a2, a2))
+#define ARITH_DIV_MULTIPLES_4(a, a2, a3, a4)                                   \
+  ARITH_DIV_MULTIPLES_8(a, a2, a3, a4, ARITH_WIDE_ADD(a4, a4))
+#define ARITH_DIV_MULTIPLES_8(a, a2, a3, a4, a8)                               \
+  (ARITH_WIDE(ARITH_ZERO), a, a2, a3, a4, ARITH_WIDE_ADD(a4, a),               \
+   ARITH_WIDE_ADD(a4, a2), ARITH_WIDE_ADD(a4, a3), a8, ARITH_WIDE_ADD(a8, a))
+
+/* (overflow, digits...): the sum overflows if either operand or the addition
+ * of their digits does */
+#define ARITH_WIDE(a) (0, EXPAND a)
+#define ARITH_WIDE_ADD(a, b)                                                   \
+  ARITH_WIDE_ADD_(IIF(FIRST_ARG a)(1, FIRST_ARG b),                            \
+                  ARITH_RIPPLE(ARITH_ADD_DIGIT, (0),                           \
+                               ARITH_ZIP(ARITH_DIGITS(a), ARITH_DIGITS(b))))
+#define ARITH_WIDE_ADD_(o, acc) ARITH_WIDE_ADD__(o, EXPAND acc)
+#define ARITH_WIDE_ADD__(...) ARITH_WIDE_ADD___(__VA_ARGS__)
+#define ARITH_WIDE_ADD___(o, c, ...) (IIF(o)(1, c), __VA_ARGS__)
+
+#define ARITH_PICK(d, m) ARITH_PICK_(d, EXPAND m)
+#define ARITH_PICK_(...) ARITH_PICK__(__VA_ARGS__)
+#define ARITH_PICK__(d, ...) CAT(ARITH_PICK_, d)(__VA_ARGS__)
+/* clang-format off */
+#define ARITH_PICK_0(m0, ...) m0
+#define ARITH_PICK_1(m0, m1, ...) m1
+#define ARITH_PICK_2(m0, m1, m2, ...) m2
+#define ARITH_PICK_3(m0, m1, m2, m3, ...) m3
+#define ARITH_PICK_4(m0, m1, m2, m3, m4, ...) m4
+#define ARITH_PICK_5(m0, m1, m2, m3, m4, m5, ...) m5
+#define ARITH_PICK_6(m0, m1, m2, m3, m4, m5, m6, ...) m6
+#define ARITH_PICK_7(m0, m1, m2, m3, m4, m5, m6, m7, ...) m7
+#define ARITH_PICK_8(m0, m1, m2, m3, m4, m5, m6, m7, m8, ...) m8
+#define ARITH_PICK_9(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9) m9
+/* clang-format on */
+
+/* a * 10, a * 10 + d (modulo 10^ARITH_WIDTH), and a / 10 */
+#define ARITH_SHIFT(a) ARITH_SHIFT_IN(a, 0)
+#define ARITH_SHIFT_IN(a, d) ARITH_SHIFT_IN_(EXPAND a, d)
+#define ARITH_SHIFT_IN_(...) ARITH_SHIFT_IN__(__VA_ARGS__)
+#define ARITH_SHIFT_IN__(d7, ...) (__VA_ARGS__)
+#define ARITH_UNSHIFT(a) ARITH_UNSHIFT_(EXPAND a)
+#define ARITH_UNSHIFT_(...) ARITH_UNSHIFT__(__VA_ARGS__)
+#define ARITH_UNSHIFT__(d7, d6, d5, d4, d3, d2, d1, d0)                        \
+  (0, d7, d6, d5, d4, d3, d2, d1)
+
+/* transition functions */
+
+#define CM_ADD(p, f, acc, ...)                                                 \
+  ARITH_FOLD_START(f, ARITH_ADD, ARITH_ADD, EXPAND, acc, __VA_ARGS__)
+#define CM_SUB(p, f, acc, ...)                                                 \
+  ARITH_FOLD_START(f, ARITH_SUB, ARITH_SUB, EXPAND, acc, __VA_ARGS__)
+#define CM_MUL(p, f, acc, ...)                                                 \
+  ARITH_FOLD_START(f, ARITH_MUL, ARITH_MUL, EXPAND, acc, __VA_ARGS__)
+/* only the quotient is divided further */
+#define CM_DIVMOD(p, f, acc, ...)                                              \
+  ARITH_FOLD_START(f, ARITH_DIV, ARITH_DIVMOD, ARITH_LONE_DIVMOD, acc,         \
+                   __VA_ARGS__)
+#define CM_LT(p, f, acc, ...) ARITH_CMP_START(f, ARITH_LT, acc, __VA_ARGS__)
+#define CM_EQ(p, f, acc, ...) ARITH_CMP_START(f, ARITH_EQ, acc, __VA_ARGS__)
+
+/* a lone operand is the result as is (with a zero remainder for DIVMOD), and
+ * compares true */
+#define ARITH_FOLD_START(f, op, last_op, lone, acc, ...)                       \
+  IIF(IS_EMPTY(__VA_ARGS__))                                                   \
+  (ARITH_FOLD_LONE, ARITH_FOLD_STEP)(f, op, last_op, lone, acc, __VA_ARGS__)
+#define ARITH_FOLD_LONE(f, op, last_op, lone, acc, ...) (, RETURN, (lone(acc)))
+#define ARITH_LONE_DIVMOD(a) a, ARITH_ZERO
+#define ARITH_CMP_START(f, op, acc, ...)                                       \
+  IIF(IS_EMPTY(__VA_ARGS__))                                                   \
+  (ARITH_CMP_LONE, ARITH_CMP_STEP)(f, op, acc, __VA_ARGS__)
+#define ARITH_CMP_LONE(f, op, acc, ...) (, RETURN, (1))
+
+#define ARITH_FOLD_STEP(f, op, last_op, lone, acc, n, ...)                     \
+  IIF(IS_EMPTY(__VA_ARGS__))                                                   \
+  (ARITH_FOLD_LAST, ARITH_FOLD_NEXT)(f, op, last_op, acc, n, __VA_ARGS__)
+#define ARITH_FOLD_NEXT(f, op, last_op, acc, n, ...)                           \
+  (, f, op(acc, n), __VA_ARGS__)
+#define ARITH_FOLD_LAST(f, op, last_op, acc, n, ...)                           \
+  (, RETURN, (last_op(acc, n)))
+
+#define ARITH_CMP_STEP(f, op, acc, n, ...)                                     \
+  IIF(op(acc, n))                                                              \
+  (IIF(IS_EMPTY(__VA_ARGS__))((, RETURN, (1)), (, f, n, __VA_ARGS__)),         \
+   (, RETURN, (0)))
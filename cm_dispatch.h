@@ -0,0 +1,75 @@
+/**
+ * @file cm_dispatch.h
+ * @brief Threaded dispatch for bytecode interpreters, from a list of opcodes.
+ *
+ * @section dispatch_usage Usage
+ * `CM_DISPATCH(op, A, B, C)` starts the dispatch loop of an interpreter whose
+ * opcodes are the enumerators `A = 0, B = 1, C = 2` (e.g. from `CM_ENUM` of
+ * `cm_enum.h` on the same list), and jumps to the handler of `op`. Handlers
+ * start with `CM_OP(name):` and end with `CM_NEXT(op)`, which jumps to the
+ * handler of the next opcode, or leave the loop with `return` or `goto`. The
+ * loop is closed by `CM_DISPATCH_END`. Example:
+ *
+ * @code
+ * #include "cm_dispatch.h"
+ *
+ * #define OPCODES PUSH, ADD, HALT
+ * enum { OPCODES };
+ *
+ * int run(const int *pc) {
+ *   int stack[16], *sp = stack;
+ *   CM_DISPATCH(*pc++, OPCODES)
+ *   CM_OP(PUSH): *sp++ = *pc++; CM_NEXT(*pc++);
+ *   CM_OP(ADD): sp--, sp[-1] += *sp; CM_NEXT(*pc++);
+ *   CM_OP(HALT): return sp[-1];
+ *   CM_DISPATCH_END
+ *   return -1; // unknown opcode, with CM_DISPATCH_SWITCH
+ * }
+ * @endcode
+ *
+ * On GCC and Clang, `CM_DISPATCH` declares a table of label addresses,
+ * `&&cm_op_A, &&cm_op_B, ...`, built with `FOREACH`, `CM_OP(A)` is the label
+ * `cm_op_A`, and `CM_NEXT(op)` is `goto *table[op]`. Every handler thus ends
+ * with an indirect jump of its own, which the branch predictor tracks
+ * separately, instead of all of them going back to a single `switch`. Other
+ * compilers, or any when `CM_DISPATCH_SWITCH` is defined, get a `switch` in a
+ * loop with `case A:` labels from the same code.
+ *
+ * Handlers shall be written for every opcode of the list, in any order.
+ * Opcodes out of range are not checked by the table, and fall out of the
+ * `switch`, after `CM_DISPATCH_END`. There can be one dispatch loop per
+ * function, and it shall not be entered other than through `CM_DISPATCH`.
+ */
+#pragma once
+#include "macro_helpers.h"
+
+#if defined(__GNUC__) && !defined(CM_DISPATCH_SWITCH)
+
+#define CM_DISPATCH(op, ...)                                                   \
+  {                                                                            \
+    static void *const cm_dispatch_table[] = {                                 \
+        FOREACH(CM_DISPATCH_LABEL, __VA_ARGS__)};                              \
+    CM_NEXT(op);
+#define CM_DISPATCH_LABEL(name) &&cm_op_##name,
+#define CM_OP(name) cm_op_##name
+#define CM_NEXT(op) goto *cm_dispatch_table[op]
+#define CM_DISPATCH_END }
+
+#else
+
+#define CM_DISPATCH(op, ...)                                                   \
+  {                                                                            \
+    int cm_dispatch_op = (op);                                                 \
+    cm_dispatch:                                                               \
+    switch (cm_dispatch_op) {
+#define CM_OP(name) case name
+#define CM_NEXT(op)                                                            \
+  do {                                                                         \
+    cm_dispatch_op = (op);                                                     \
+    goto cm_dispatch;                                                          \
+  } while (0)
+#define CM_DISPATCH_END                                                        \
+  }                                                                            \
+  }
+
+#endif
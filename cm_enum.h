@@ -0,0 +1,119 @@
+/**
+ * @file cm_enum.h
+ * @brief Enums with names, count and lookup by name, from a single list.
+ *
+ * @section enum_usage Usage
+ * `CM_ENUM(Name, A, B, C)` declares:
+ *
+ * @code
+ * enum Name { A, B, C };
+ * static const char *const Name_names[] = {"A", "B", "C"};
+ * enum { Name_COUNT = 3 };
+ * static inline const char *Name_to_string(enum Name value);
+ * static inline int Name_from_string(const char *name, enum Name *value);
+ * @endcode
+ *
+ * `Name_to_string` returns `NULL` for values out of range. `Name_from_string`
+ * stores the value and returns 1 if `name` is one of the names, 0 otherwise.
+ * It looks names up in an open addressing hash table (FNV-1a, at most half
+ * full), so it takes one or two string comparisons instead of one per name.
+ *
+ * Names are stringified with `FOREACH_I`, the enumerators are the list itself,
+ * and the count is the size of the name table, so nothing is limited by
+ * `PP_NARG`: lists of any length `CM` can iterate over are supported.
+ * Enumerators shall not have explicit values.
+ *
+ * The hash table is filled on the first call of `Name_from_string`. With GCC
+ * and Clang, the thread that claims it fills it and publishes it with a
+ * release store, and other threads compare the names one by one until it is
+ * ready, so the function can be called from several threads at once.
+ *
+ * @note Other compilers have no atomics here: call `Name_from_string` once
+ * before using it from several threads.
+ */
+#pragma once
+#include <stddef.h>
+#include <string.h>
+#include "macro_helpers.h"
+
+#define CM_ENUM(name, ...)                                                     \
+  enum name { __VA_ARGS__ };                                                   \
+  static const char *const name##_names[] = {                                  \
+      FOREACH_I(CM_ENUM_NAME, , COMMA, __VA_ARGS__)};                          \
+  enum { name##_COUNT = sizeof(name##_names) / sizeof(name##_names[0]) };      \
+  static inline const char *name##_to_string(enum name value) {                \
+    return (size_t)value < name##_COUNT ? name##_names[value] : NULL;          \
+  }                                                                            \
+  static inline int name##_from_string(const char *str, enum name *value) {    \
+    static size_t slots[CM_ENUM_SLOTS(name##_COUNT) + 1];                      \
+    size_t i = cm_enum_find(name##_names, name##_COUNT, slots,                 \
+                            CM_ENUM_SLOTS(name##_COUNT), str);                 \
+    if (i == name##_COUNT) return 0;                                           \
+    *value = (enum name)i;                                                     \
+    return 1;                                                                  \
+  }
+
+#define CM_ENUM_NAME(ctx, i, x) #x
+
+/* smallest power of 2 that is at least twice n, for n < 2^31 */
+#define CM_ENUM_SLOTS(n) (CM_ENUM_POW2((size_t)(n) * 2 - 1) + 1)
+#define CM_ENUM_POW2(x) CM_ENUM_OR_16(CM_ENUM_OR_4(CM_ENUM_OR_1(x)))
+#define CM_ENUM_OR_1(x) CM_ENUM_OR(CM_ENUM_OR(x, 1), 2)
+#define CM_ENUM_OR_4(x) CM_ENUM_OR(CM_ENUM_OR(x, 4), 8)
+#define CM_ENUM_OR_16(x) CM_ENUM_OR(x, 16)
+#define CM_ENUM_OR(x, shift) ((x) | (x) >> (shift))
+
+static inline size_t cm_enum_hash(const char *str) {
+  size_t hash = 2166136261u;
+  for (; *str; str++) hash = (hash ^ (unsigned char)*str) * 16777619u;
+  return hash;
+}
+
+/* slots[n_slots] of a table that is being filled, or can be used */
+#define CM_ENUM_FILLING 1
+#define CM_ENUM_READY 2
+
+#if defined(__GNUC__)
+#define CM_ENUM_LOAD(flag) __atomic_load_n(flag, __ATOMIC_ACQUIRE)
+#define CM_ENUM_STORE(flag, v) __atomic_store_n(flag, v, __ATOMIC_RELEASE)
+#else
+#define CM_ENUM_LOAD(flag) (*(flag))
+#define CM_ENUM_STORE(flag, v) (*(flag) = (v))
+#endif
+
+/* 1 if the caller is the one to fill the table */
+static inline int cm_enum_claim(size_t *flag) {
+#if defined(__GNUC__)
+  size_t expected = 0;
+  return __atomic_compare_exchange_n(flag, &expected, CM_ENUM_FILLING, 0,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+#else
+  return *flag == 0 ? (*flag = CM_ENUM_FILLING, 1) : 0;
+#endif
+}
+
+/* `slots` holds index + 1 of the name hashed to it (or the next free one), or
+ * 0; slots[n_slots] is 0, CM_ENUM_FILLING or CM_ENUM_READY */
+static inline size_t cm_enum_find(const char *const *names, size_t count,
+                                  size_t *slots, size_t n_slots,
+                                  const char *str) {
+  size_t mask = n_slots - 1;
+  size_t i;
+  if (CM_ENUM_LOAD(&slots[n_slots]) != CM_ENUM_READY) {
+    if (!cm_enum_claim(&slots[n_slots])) {
+      /* another thread is filling it */
+      for (i = 0; i < count; i++)
+        if (strcmp(names[i], str) == 0) return i;
+      return count;
+    }
+    for (i = 0; i < count; i++) {
+      size_t slot = cm_enum_hash(names[i]) & mask;
+      while (slots[slot]) slot = (slot + 1) & mask;
+      slots[slot] = i + 1;
+    }
+    CM_ENUM_STORE(&slots[n_slots], CM_ENUM_READY);
+  }
+  for (i = cm_enum_hash(str) & mask; slots[i]; i = (i + 1) & mask)
+    if (strcmp(names[slots[i] - 1], str) == 0) return slots[i] - 1;
+  return count;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file cm_seq.h
+ * @brief Sequences, stacks, queues and deques for machine state.
+ *
+ * @section seq_usage Usage
+ * A sequence is a list of parenthesized elements, like `(a)(b)(c)`, and the
+ * empty sequence is nothing at all (`SEQ_NIL`). Elements may contain commas.
+ * Example:
+ *
+ * @code
+ * #include "cm_seq.h"
+ * #include "continuation_machine.h"
+ *
+ * #define CM_PUSH_ALL(p, f, stack, x, ...)                                    \
+ *   (, IF(IS_EMPTY(__VA_ARGS__))(PUSH_DONE, f), STACK_PUSH(stack, x),         \
+ *    __VA_ARGS__)
+ * #define CM_PUSH_DONE(p, f, stack, ...) CM_RETURN(p, f, (SEQ_ENUM(stack)))
+ *
+ * CM(PUSH_ALL, SEQ_NIL, 1, 2, 3) // expands to 3, 2, 1
+ * @endcode
+ *
+ * A sequence has no commas between elements, so the whole of it is a single
+ * argument, and can be the `state` of a machine as is. Appending to it is
+ * juxtaposition, and removing the first element is a single invocation of
+ * `DISCARD` on it, so unlike a tuple, which is rebuilt with `EXPAND` on every
+ * change, it is not rescanned once more per step.
+ *
+ * Operations on sequences:
+ * - `SEQ_PUSH_FRONT(seq, x)`, `SEQ_PUSH_BACK(seq, x)`, `SEQ_TAIL(seq)`,
+ *   `SEQ_HEAD(seq)`, `SEQ_IS_EMPTY(seq)`: a constant number of invocations,
+ *   whatever the length of `seq`.
+ * - `SEQ_ELEMS(seq)`, `SEQ_ENUM(seq)`: elements, juxtaposed or separated by
+ *   commas. One invocation per element.
+ * - `SEQ_REVERSE(seq)`: one invocation per element, but nested, so it copies
+ *   `O(n^2)` tokens.
+ *
+ * On top of them:
+ * - stack: `STACK_PUSH(s, x)`, `STACK_POP(s)`, `STACK_TOP(s)`.
+ * - queue: `QUEUE_PUSH(q, x)`, `QUEUE_POP(q)`, `QUEUE_FRONT(q)`.
+ * - deque: a pair of sequences `(front, back)`, where `back` is reversed, so
+ *   that both ends are at the head of a sequence. `DEQUE_NIL`,
+ *   `DEQUE_PUSH_FRONT(d, x)`, `DEQUE_PUSH_BACK(d, x)`, `DEQUE_POP_FRONT(d)`,
+ *   `DEQUE_POP_BACK(d)`, `DEQUE_FRONT(d)`, `DEQUE_BACK(d)`,
+ *   `DEQUE_IS_EMPTY(d)`, `DEQUE_TO_SEQ(d)`. When the end being accessed is
+ *   empty, the other one is reversed with `SEQ_REVERSE`, which copies `O(n^2)`
+ *   tokens for `n` elements. Operations are thus not amortized `O(1)`: popping
+ *   `n` elements pushed at the other end copies `O(n^2)` tokens, and
+ *   `DEQUE_FRONT` and `DEQUE_BACK` do not keep the reversed sequence, so each
+ *   of them on an empty end copies as many again.
+ *
+ * None of them uses `CM`, so they can be used inside transition functions.
+ * This header only needs `macro_primitives.h`, so it does not define `CM`.
+ *
+ * @note Elements are not expanded any further once they are in a sequence,
+ * but the whole state of a machine is still copied on every iteration, so
+ * large states are better emitted with `CM_EMIT` than accumulated.
+ */
+#pragma once
+#include "macro_primitives.h"
+
+#define SEQ_NIL
+
+#define SEQ_PUSH_FRONT(seq, ...) (__VA_ARGS__)seq
+#define SEQ_PUSH_BACK(seq, ...) seq(__VA_ARGS__)
+#define SEQ_TAIL(seq) DISCARD seq
+#define SEQ_IS_EMPTY(seq) IS_EMPTY(seq)
+
+/* the tail is moved past a comma, and dropped */
+#define SEQ_HEAD(seq) SEQ_HEAD_(SEQ_HEAD_SPLIT seq)
+#define SEQ_HEAD_SPLIT(...) (__VA_ARGS__),
+#define SEQ_HEAD_(...) SEQ_HEAD__(__VA_ARGS__)
+#define SEQ_HEAD__(head, ...) EXPAND head
+
+/* walks: each macro expands to an element and to the name of the other one,
+ * which is invoked on the next element. The name left after the last one is
+ * pasted with _END, which expands to nothing. */
+#define SEQ_ELEMS(seq) SEQ_END(SEQ_ELEMS_A seq)
+#define SEQ_ELEMS_A(...) __VA_ARGS__ SEQ_ELEMS_B
+#define SEQ_ELEMS_B(...) __VA_ARGS__ SEQ_ELEMS_A
+#define SEQ_ELEMS_A_END
+#define SEQ_ELEMS_B_END
+
+#define SEQ_ENUM(seq) SEQ_END(SEQ_ENUM_FIRST seq)
+#define SEQ_ENUM_FIRST(...) __VA_ARGS__ SEQ_ENUM_A
+#define SEQ_ENUM_A(...) , __VA_ARGS__ SEQ_ENUM_B
+#define SEQ_ENUM_B(...) , __VA_ARGS__ SEQ_ENUM_A
+#define SEQ_ENUM_FIRST_END
+#define SEQ_ENUM_A_END
+#define SEQ_ENUM_B_END
+
+#define SEQ_END(...) SEQ_END_(__VA_ARGS__)
+#define SEQ_END_(...) __VA_ARGS__##_END
+
+/* (a)(b)(c) is turned into SEQ_REVERSE_PUSH((a), SEQ_REVERSE_PUSH((b),
+ * SEQ_REVERSE_PUSH((c), ))) by two walks: one opens the invocations, the other
+ * closes them. Parentheses are deferred, so that they are unbalanced only
+ * after SEQ_END, and come after the name of the macro has been passed, so
+ * that nothing is invoked until the result is rescanned by SEQ_REVERSE_. */
+#define SEQ_REVERSE(seq)                                                       \
+  SEQ_REVERSE_(SEQ_END(SEQ_REVERSE_OPEN_A seq) SEQ_END(SEQ_REVERSE_CLOSE_A seq))
+#define SEQ_REVERSE_(...) __VA_ARGS__
+#define SEQ_REVERSE_PUSH(x, seq) seq x
+#define SEQ_REVERSE_OPEN_A(...)                                                \
+  SEQ_REVERSE_PUSH DEFER(SEQ_LPAREN)()(__VA_ARGS__), SEQ_REVERSE_OPEN_B
+#define SEQ_REVERSE_OPEN_B(...)                                                \
+  SEQ_REVERSE_PUSH DEFER(SEQ_LPAREN)()(__VA_ARGS__), SEQ_REVERSE_OPEN_A
+#define SEQ_REVERSE_CLOSE_A(...) DEFER(SEQ_RPAREN)() SEQ_REVERSE_CLOSE_B
+#define SEQ_REVERSE_CLOSE_B(...) DEFER(SEQ_RPAREN)() SEQ_REVERSE_CLOSE_A
+#define SEQ_REVERSE_OPEN_A_END
+#define SEQ_REVERSE_OPEN_B_END
+#define SEQ_REVERSE_CLOSE_A_END
+#define SEQ_REVERSE_CLOSE_B_END
+#define SEQ_LPAREN() (
+#define SEQ_RPAREN() )
+
+/* stack and queue */
+
+#define STACK_PUSH(seq, ...) SEQ_PUSH_FRONT(seq, __VA_ARGS__)
+#define STACK_POP(seq) SEQ_TAIL(seq)
+#define STACK_TOP(seq) SEQ_HEAD(seq)
+
+#define QUEUE_PUSH(seq, ...) SEQ_PUSH_BACK(seq, __VA_ARGS__)
+#define QUEUE_POP(seq) SEQ_TAIL(seq)
+#define QUEUE_FRONT(seq) SEQ_HEAD(seq)
+
+/* deque */
+
+#define DEQUE_NIL (, )
+
+#define DEQUE_PUSH_FRONT(deque, ...) DEQUE_PUSH_FRONT_(deque, (__VA_ARGS__))
+#define DEQUE_PUSH_FRONT_(deque, x) DEQUE_PUSH_FRONT__(x, EXPAND deque)
+#define DEQUE_PUSH_FRONT__(...) DEQUE_PUSH_FRONT___(__VA_ARGS__)
+#define DEQUE_PUSH_FRONT___(x, front, back) (x front, back)
+
+#define DEQUE_PUSH_BACK(deque, ...) DEQUE_PUSH_BACK_(deque, (__VA_ARGS__))
+#define DEQUE_PUSH_BACK_(deque, x) DEQUE_PUSH_BACK__(x, EXPAND deque)
+#define DEQUE_PUSH_BACK__(...) DEQUE_PUSH_BACK___(__VA_ARGS__)
+#define DEQUE_PUSH_BACK___(x, front, back) (front, x back)
+
+#define DEQUE_POP_FRONT(deque) DEQUE_POP_FRONT_(EXPAND deque)
+#define DEQUE_POP_FRONT_(...) DEQUE_POP_FRONT__(__VA_ARGS__)
+#define DEQUE_POP_FRONT__(front, back)                                         \
+  IIF(SEQ_IS_EMPTY(front))(DEQUE_POP_REVERSED, DEQUE_POP)(front, back)
+#define DEQUE_POP(front, back) (SEQ_TAIL(front), back)
+#define DEQUE_POP_REVERSED(front, back) (SEQ_TAIL(SEQ_REVERSE(back)), )
+
+#define DEQUE_POP_BACK(deque) DEQUE_POP_BACK_(EXPAND deque)
+#define DEQUE_POP_BACK_(...) DEQUE_POP_BACK__(__VA_ARGS__)
+#define DEQUE_POP_BACK__(front, back)                                          \
+  DEQUE_SWAP(IIF(SEQ_IS_EMPTY(back))(DEQUE_POP_REVERSED, DEQUE_POP)(back,      \
+                                                                    front))
+
+#define DEQUE_FRONT(deque) DEQUE_FRONT_(EXPAND deque)
+#define DEQUE_FRONT_(...) DEQUE_FRONT__(__VA_ARGS__)
+#define DEQUE_FRONT__(front, back)                                             \
+  SEQ_HEAD(IIF(SEQ_IS_EMPTY(front))(SEQ_REVERSE, EXPAND)(                      \
+      IIF(SEQ_IS_EMPTY(front))(back, front)))
+
+#define DEQUE_BACK(deque) DEQUE_FRONT(DEQUE_SWAP(deque))
+#define DEQUE_SWAP(deque) DEQUE_SWAP_(EXPAND deque)
+#define DEQUE_SWAP_(...) DEQUE_SWAP__(__VA_ARGS__)
+#define DEQUE_SWAP__(front, back) (back, front)
+
+#define DEQUE_IS_EMPTY(deque) DEQUE_IS_EMPTY_(EXPAND deque)
+#define DEQUE_IS_EMPTY_(...) DEQUE_IS_EMPTY__(__VA_ARGS__)
+#define DEQUE_IS_EMPTY__(front, back) SEQ_IS_EMPTY(front back)
+#define DEQUE_TO_SEQ(deque) DEQUE_TO_SEQ_(EXPAND deque)
+#define DEQUE_TO_SEQ_(...) DEQUE_TO_SEQ__(__VA_ARGS__)
+#define DEQUE_TO_SEQ__(front, back) front SEQ_REVERSE(back)
@@ -0,0 +1,334 @@
+/**
+ * @file cm_sort.h
+ * @brief Sorting networks generated at preprocessing time.
+ *
+ * @section sortnet_usage Usage
+ * `CM_SORTNET(n, cmp)` expands to the comparators of Batcher's odd-even merge
+ * sort of `n` elements, `1 <= n <= 64`, as a sequence of `cmp(i, j)`, where
+ * `i < j` are decimal literals. `cmp` shall put the smaller of elements `i` and
+ * `j` into `i`, and is usually a branch-free compare and swap. Example:
+ *
+ * @code
+ * #include "cm_sort.h"
+ *
+ * #define CMP_SWAP(i, j)                                                     \
+ *   {                                                                        \
+ *     int lo = a[i] < a[j] ? a[i] : a[j], hi = a[i] < a[j] ? a[j] : a[i];    \
+ *     a[i] = lo, a[j] = hi;                                                  \
+ *   }
+ *
+ * void sort8(int a[8]) { CM_SORTNET(8, CMP_SWAP) }
+ * @endcode
+ *
+ * Comparators come out layer by layer, and the comparators of a layer touch
+ * distinct elements, so the compiler is free to vectorize them. For `n` that is
+ * not a power of 2, the network for the next power of 2 is used, without the
+ * comparators that touch elements past `n - 1`.
+ *
+ * The machine runs one iteration per layer and element, at most 21 * 64 = 1344
+ * iterations, which fits into the default `CM_MAX_LEVEL`. Any other `n`,
+ * including 0, invokes `CM_ERROR_UNSUPPORTED_SORTNET_SIZE` with a wrong number
+ * of arguments, which fails preprocessing.
+ *
+ * @note `cmp` is invoked from within a transition function, so it shall not
+ * use `CM`.
+ */
+#pragma once
+#include "continuation_machine.h"
+
+#define CM_SORTNET(n, cmp)                                                     \
+  IIF(SORTNET_IS_SIZE(CAT(SORTNET_LAST_, n)))                                  \
+  (SORTNET_, CM_ERROR_UNSUPPORTED_SORTNET_SIZE)(cmp, CAT(SORTNET_LAST_, n))
+/* 1 if SORTNET_LAST_n is defined, i.e. expands to 6 bits */
+#define SORTNET_IS_SIZE(...) SORTNET_IS_SIZE_(__VA_ARGS__, 1, 0, 0, 0, 0, 0, 0)
+#define SORTNET_IS_SIZE_(b5, b4, b3, b2, b1, b0, is_size, ...) is_size
+#define CM_ERROR_UNSUPPORTED_SORTNET_SIZE() /* NOTE: if you see this in your error output, n of CM_SORTNET is not in 1..64. */
+#define SORTNET_(...) SORTNET__(__VA_ARGS__)
+#define SORTNET__(cmp, c5, c4, c3, c2, c1, c0)                                 \
+  CM(SORTNET_STEP,                                                             \
+     (cmp, c5, c4, c3, c2, c1, c0, 0, 0, 0, 0, 0, 1,                           \
+      SORTNET_PREFIX(c5, c4, c3, c2, c1), 0),                                  \
+     c5, c4, c3, c2, c1, c0)
+
+/* Indices are 6 bits, most significant first. State is (cmp, c, r, m), where
+ * c is n - 1, and the current layer compares elements a and a + 2^r within
+ * blocks of 2^(m + 1) elements. r is a one-hot mask, m is a mask of bits
+ * r + 1 ... m. Layers are visited backwards, and a goes from c down to 0, so
+ * that CM_EMIT puts comparators in order. */
+#define CM_SORTNET_STEP(p, f, state, ...)                                      \
+  SORTNET_EMIT((SORTNET_COMPARATOR(EXPAND state, __VA_ARGS__)), ,              \
+               SORTNET_NEXT(f, EXPAND state, __VA_ARGS__))
+#define SORTNET_EMIT(...) CM_EMIT(__VA_ARGS__)
+
+#define SORTNET_COMPARATOR(...) SORTNET_COMPARATOR_(__VA_ARGS__)
+#define SORTNET_COMPARATOR_(cmp, c5, c4, c3, c2, c1, c0, r5, r4, r3, r2, r1,   \
+                            r0, m5, m4, m3, m2, m1, m0, a5, a4, a3, a2, a1,    \
+                            a0)                                                \
+  SORTNET_COMPARATOR__(                                                        \
+      cmp, c5, c4, c3, c2, c1, c0,                                             \
+      SORTNET_IN_LAYER(r5, r4, r3, r2, r1, r0, m5, m4, m3, m2, m1, m0, a5, a4, \
+                       a3, a2, a1, a0),                                        \
+      a5, a4, a3, a2, a1, a0,                                                  \
+      SORTNET_ADD(0, a5, a4, a3, a2, a1, a0, r5, r4, r3, r2, r1, r0))
+#define SORTNET_COMPARATOR__(...) SORTNET_COMPARATOR___(__VA_ARGS__)
+#define SORTNET_COMPARATOR___(cmp, c5, c4, c3, c2, c1, c0, in_layer, a5, a4,   \
+                              a3, a2, a1, a0, carry, b5, b4, b3, b2, b1, b0)   \
+  IIF(SORTNET_AND(in_layer, SORTNET_NOT_GREATER(b5, b4, b3, b2, b1, b0, c5,    \
+                                                c4, c3, c2, c1, c0)))(         \
+      cmp, DISCARD)(SORTNET_NUM(a5, a4, a3, a2, a1, a0),                       \
+                    SORTNET_NUM(b5, b4, b3, b2, b1, b0))
+
+/* with m empty (r = m), bit r of a shall be 0. Otherwise it shall be 1, and
+ * adding 2^r shall not carry out of bit m, i.e. bits r + 1 ... m of a shall
+ * not all be 1. */
+#define SORTNET_IN_LAYER(r5, r4, r3, r2, r1, r0, m5, m4, m3, m2, m1, m0, a5,   \
+                         a4, a3, a2, a1, a0)                                   \
+  SORTNET_IN_LAYER_(                                                           \
+      SORTNET_IS_ZERO(m5, m4, m3, m2, m1, m0),                                 \
+      SORTNET_IS_ZERO(SORTNET_AND(r5, a5), SORTNET_AND(r4, a4),                \
+                      SORTNET_AND(r3, a3), SORTNET_AND(r2, a2),                \
+                      SORTNET_AND(r1, a1), SORTNET_AND(r0, a0)),               \
+      SORTNET_IS_ZERO(SORTNET_AND(m5, COMPL(a5)), SORTNET_AND(m4, COMPL(a4)),  \
+                      SORTNET_AND(m3, COMPL(a3)), SORTNET_AND(m2, COMPL(a2)),  \
+                      SORTNET_AND(m1, COMPL(a1)), SORTNET_AND(m0, COMPL(a0))))
+#define SORTNET_IN_LAYER_(last, bit_clear, all_set)                            \
+  IIF(last)(bit_clear, SORTNET_AND(COMPL(bit_clear), COMPL(all_set)))
+
+/* b <= c, i.e. c + ~b + 1 carries */
+#define SORTNET_NOT_GREATER(b5, b4, b3, b2, b1, b0, c5, c4, c3, c2, c1, c0)    \
+  SORTNET_CARRY(SORTNET_ADD(1, c5, c4, c3, c2, c1, c0, COMPL(b5), COMPL(b4),   \
+                            COMPL(b3), COMPL(b2), COMPL(b1), COMPL(b0)))
+
+#define SORTNET_NEXT(...) SORTNET_NEXT_(__VA_ARGS__)
+#define SORTNET_NEXT_(f, cmp, c5, c4, c3, c2, c1, c0, r5, r4, r3, r2, r1, r0,  \
+                      m5, m4, m3, m2, m1, m0, ...)                             \
+  IIF(SORTNET_IS_ZERO(__VA_ARGS__))(SORTNET_NEXT_LAYER, SORTNET_NEXT_INDEX)(   \
+      f, (cmp, c5, c4, c3, c2, c1, c0), (r5, r4, r3, r2, r1, r0),              \
+      (m5, m4, m3, m2, m1, m0), __VA_ARGS__)
+#define SORTNET_NEXT_INDEX(f, cmp_c, r, m, ...)                                \
+  f, (EXPAND cmp_c, EXPAND r, EXPAND m), SORTNET_DEC(__VA_ARGS__)
+
+/* r = m: the last layer of this merge, continues with r = 0 of the previous
+ * one, or exits after r = m = 0. Otherwise r moves one bit up. */
+#define SORTNET_NEXT_LAYER(f, cmp_c, r, m, ...)                                \
+  IIF(SORTNET_IS_ZERO m)(SORTNET_NEXT_MERGE, SORTNET_NEXT_BIT)(                \
+      f, EXPAND cmp_c, EXPAND r, EXPAND m)
+#define SORTNET_NEXT_MERGE(...) SORTNET_NEXT_MERGE_(__VA_ARGS__)
+#define SORTNET_NEXT_MERGE_(f, cmp, c5, c4, c3, c2, c1, c0, r5, r4, r3, r2,    \
+                            r1, r0, ...)                                       \
+  IIF(r0)(EXIT, f),                                                            \
+      (cmp, c5, c4, c3, c2, c1, c0, 0, 0, 0, 0, 0, 1,                          \
+       SORTNET_PREFIX(0, r5, r4, r3, r2), 0),                                  \
+      c5, c4, c3, c2, c1, c0
+#define SORTNET_NEXT_BIT(...) SORTNET_NEXT_BIT_(__VA_ARGS__)
+#define SORTNET_NEXT_BIT_(f, cmp, c5, c4, c3, c2, c1, c0, r5, r4, r3, r2, r1,  \
+                          r0, m5, m4, m3, m2, m1, m0)                          \
+  f,                                                                           \
+      (cmp, c5, c4, c3, c2, c1, c0, r4, r3, r2, r1, r0, 0,                     \
+       SORTNET_AND(m5, COMPL(r4)), SORTNET_AND(m4, COMPL(r3)),                 \
+       SORTNET_AND(m3, COMPL(r2)), SORTNET_AND(m2, COMPL(r1)),                 \
+       SORTNET_AND(m1, COMPL(r0)), 0),                                         \
+      c5, c4, c3, c2, c1, c0
+
+/* bits */
+
+/* x5, x5 | x4, ..., x5 | x4 | x3 | x2 | x1 */
+#define SORTNET_PREFIX(x5, x4, x3, x2, x1)                                     \
+  SORTNET_PREFIX_(x5, SORTNET_OR(x5, x4), x3, x2, x1)
+#define SORTNET_PREFIX_(x5, p4, x3, x2, x1)                                    \
+  SORTNET_PREFIX__(x5, p4, SORTNET_OR(p4, x3), x2, x1)
+#define SORTNET_PREFIX__(x5, p4, p3, x2, x1)                                   \
+  SORTNET_PREFIX___(x5, p4, p3, SORTNET_OR(p3, x2), x1)
+#define SORTNET_PREFIX___(x5, p4, p3, p2, x1) x5, p4, p3, p2, SORTNET_OR(p2, x1)
+
+/* 6 bit a + b + carry, expands to `carry, sum` */
+#define SORTNET_ADD(c, a5, a4, a3, a2, a1, a0, b5, b4, b3, b2, b1, b0)         \
+  SORTNET_ADD_1(a5, a4, a3, a2, a1, b5, b4, b3, b2, b1, SORTNET_FA(a0, b0, c))
+#define SORTNET_ADD_1(...) SORTNET_ADD_1_(__VA_ARGS__)
+#define SORTNET_ADD_1_(a5, a4, a3, a2, a1, b5, b4, b3, b2, b1, c, s0)          \
+  SORTNET_ADD_2(a5, a4, a3, a2, b5, b4, b3, b2, SORTNET_FA(a1, b1, c), s0)
+#define SORTNET_ADD_2(...) SORTNET_ADD_2_(__VA_ARGS__)
+#define SORTNET_ADD_2_(a5, a4, a3, a2, b5, b4, b3, b2, c, s1, s0)              \
+  SORTNET_ADD_3(a5, a4, a3, b5, b4, b3, SORTNET_FA(a2, b2, c), s1, s0)
+#define SORTNET_ADD_3(...) SORTNET_ADD_3_(__VA_ARGS__)
+#define SORTNET_ADD_3_(a5, a4, a3, b5, b4, b3, c, s2, s1, s0)                  \
+  SORTNET_ADD_4(a5, a4, b5, b4, SORTNET_FA(a3, b3, c), s2, s1, s0)
+#define SORTNET_ADD_4(...) SORTNET_ADD_4_(__VA_ARGS__)
+#define SORTNET_ADD_4_(a5, a4, b5, b4, c, s3, s2, s1, s0)                      \
+  SORTNET_ADD_5(a5, b5, SORTNET_FA(a4, b4, c), s3, s2, s1, s0)
+#define SORTNET_ADD_5(...) SORTNET_ADD_5_(__VA_ARGS__)
+#define SORTNET_ADD_5_(a5, b5, c, s4, s3, s2, s1, s0)                          \
+  SORTNET_FA(a5, b5, c), s4, s3, s2, s1, s0
+
+#define SORTNET_CARRY(...) FIRST_ARG(__VA_ARGS__)
+#define SORTNET_DEC(...)                                                       \
+  SORTNET_DROP_CARRY(SORTNET_ADD(0, __VA_ARGS__, 1, 1, 1, 1, 1, 1))
+#define SORTNET_DROP_CARRY(...) SORTNET_DROP_CARRY_(__VA_ARGS__)
+#define SORTNET_DROP_CARRY_(c, ...) __VA_ARGS__
+
+#define SORTNET_IS_ZERO(...) SORTNET_IS_ZERO_(__VA_ARGS__)
+#define SORTNET_IS_ZERO_(b5, b4, b3, b2, b1, b0)                               \
+  CHECK(SORTNET_ZERO_##b5##b4##b3##b2##b1##b0)
+#define SORTNET_ZERO_000000 ~, 1,
+
+#define SORTNET_AND(a, b) SORTNET_AND_(a, b)
+#define SORTNET_AND_(a, b) SORTNET_AND_##a##b
+#define SORTNET_AND_00 0
+#define SORTNET_AND_01 0
+#define SORTNET_AND_10 0
+#define SORTNET_AND_11 1
+
+#define SORTNET_OR(a, b) SORTNET_OR_(a, b)
+#define SORTNET_OR_(a, b) SORTNET_OR_##a##b
+#define SORTNET_OR_00 0
+#define SORTNET_OR_01 1
+#define SORTNET_OR_10 1
+#define SORTNET_OR_11 1
+
+/* full adder: a + b + c, expands to `carry, sum` */
+#define SORTNET_FA(a, b, c) SORTNET_FA_(a, b, c)
+#define SORTNET_FA_(a, b, c) SORTNET_FA_##a##b##c
+#define SORTNET_FA_000 0, 0
+#define SORTNET_FA_001 0, 1
+#define SORTNET_FA_010 0, 1
+#define SORTNET_FA_011 1, 0
+#define SORTNET_FA_100 0, 1
+#define SORTNET_FA_101 1, 0
+#define SORTNET_FA_110 1, 0
+#define SORTNET_FA_111 1, 1
+
+#define SORTNET_NUM(b5, b4, b3, b2, b1, b0) SORTNET_NUM_(b5, b4, b3, b2, b1, b0)
+#define SORTNET_NUM_(b5, b4, b3, b2, b1, b0)                                   \
+  SORTNET_NUM_##b5##b4##b3##b2##b1##b0
+/* clang-format off */
+#define SORTNET_NUM_000000 0
+#define SORTNET_NUM_000001 1
+#define SORTNET_NUM_000010 2
+#define SORTNET_NUM_000011 3
+#define SORTNET_NUM_000100 4
+#define SORTNET_NUM_000101 5
+#define SORTNET_NUM_000110 6
+#define SORTNET_NUM_000111 7
+#define SORTNET_NUM_001000 8
+#define SORTNET_NUM_001001 9
+#define SORTNET_NUM_001010 10
+#define SORTNET_NUM_001011 11
+#define SORTNET_NUM_001100 12
+#define SORTNET_NUM_001101 13
+#define SORTNET_NUM_001110 14
+#define SORTNET_NUM_001111 15
+#define SORTNET_NUM_010000 16
+#define SORTNET_NUM_010001 17
+#define SORTNET_NUM_010010 18
+#define SORTNET_NUM_010011 19
+#define SORTNET_NUM_010100 20
+#define SORTNET_NUM_010101 21
+#define SORTNET_NUM_010110 22
+#define SORTNET_NUM_010111 23
+#define SORTNET_NUM_011000 24
+#define SORTNET_NUM_011001 25
+#define SORTNET_NUM_011010 26
+#define SORTNET_NUM_011011 27
+#define SORTNET_NUM_011100 28
+#define SORTNET_NUM_011101 29
+#define SORTNET_NUM_011110 30
+#define SORTNET_NUM_011111 31
+#define SORTNET_NUM_100000 32
+#define SORTNET_NUM_100001 33
+#define SORTNET_NUM_100010 34
+#define SORTNET_NUM_100011 35
+#define SORTNET_NUM_100100 36
+#define SORTNET_NUM_100101 37
+#define SORTNET_NUM_100110 38
+#define SORTNET_NUM_100111 39
+#define SORTNET_NUM_101000 40
+#define SORTNET_NUM_101001 41
+#define SORTNET_NUM_101010 42
+#define SORTNET_NUM_101011 43
+#define SORTNET_NUM_101100 44
+#define SORTNET_NUM_101101 45
+#define SORTNET_NUM_101110 46
+#define SORTNET_NUM_101111 47
+#define SORTNET_NUM_110000 48
+#define SORTNET_NUM_110001 49
+#define SORTNET_NUM_110010 50
+#define SORTNET_NUM_110011 51
+#define SORTNET_NUM_110100 52
+#define SORTNET_NUM_110101 53
+#define SORTNET_NUM_110110 54
+#define SORTNET_NUM_110111 55
+#define SORTNET_NUM_111000 56
+#define SORTNET_NUM_111001 57
+#define SORTNET_NUM_111010 58
+#define SORTNET_NUM_111011 59
+#define SORTNET_NUM_111100 60
+#define SORTNET_NUM_111101 61
+#define SORTNET_NUM_111110 62
+#define SORTNET_NUM_111111 63
+
+/* SORTNET_LAST_n: n - 1 in 6 bits */
+#define SORTNET_LAST_1  0, 0, 0, 0, 0, 0
+#define SORTNET_LAST_2  0, 0, 0, 0, 0, 1
+#define SORTNET_LAST_3  0, 0, 0, 0, 1, 0
+#define SORTNET_LAST_4  0, 0, 0, 0, 1, 1
+#define SORTNET_LAST_5  0, 0, 0, 1, 0, 0
+#define SORTNET_LAST_6  0, 0, 0, 1, 0, 1
+#define SORTNET_LAST_7  0, 0, 0, 1, 1, 0
+#define SORTNET_LAST_8  0, 0, 0, 1, 1, 1
+#define SORTNET_LAST_9  0, 0, 1, 0, 0, 0
+#define SORTNET_LAST_10 0, 0, 1, 0, 0, 1
+#define SORTNET_LAST_11 0, 0, 1, 0, 1, 0
+#define SORTNET_LAST_12 0, 0, 1, 0, 1, 1
+#define SORTNET_LAST_13 0, 0, 1, 1, 0, 0
+#define SORTNET_LAST_14 0, 0, 1, 1, 0, 1
+#define SORTNET_LAST_15 0, 0, 1, 1, 1, 0
+#define SORTNET_LAST_16 0, 0, 1, 1, 1, 1
+#define SORTNET_LAST_17 0, 1, 0, 0, 0, 0
+#define SORTNET_LAST_18 0, 1, 0, 0, 0, 1
+#define SORTNET_LAST_19 0, 1, 0, 0, 1, 0
+#define SORTNET_LAST_20 0, 1, 0, 0, 1, 1
+#define SORTNET_LAST_21 0, 1, 0, 1, 0, 0
+#define SORTNET_LAST_22 0, 1, 0, 1, 0, 1
+#define SORTNET_LAST_23 0, 1, 0, 1, 1, 0
+#define SORTNET_LAST_24 0, 1, 0, 1, 1, 1
+#define SORTNET_LAST_25 0, 1, 1, 0, 0, 0
+#define SORTNET_LAST_26 0, 1, 1, 0, 0, 1
+#define SORTNET_LAST_27 0, 1, 1, 0, 1, 0
+#define SORTNET_LAST_28 0, 1, 1, 0, 1, 1
+#define SORTNET_LAST_29 0, 1, 1, 1, 0, 0
+#define SORTNET_LAST_30 0, 1, 1, 1, 0, 1
+#define SORTNET_LAST_31 0, 1, 1, 1, 1, 0
+#define SORTNET_LAST_32 0, 1, 1, 1, 1, 1
+#define SORTNET_LAST_33 1, 0, 0, 0, 0, 0
+#define SORTNET_LAST_34 1, 0, 0, 0, 0, 1
+#define SORTNET_LAST_35 1, 0, 0, 0, 1, 0
+#define SORTNET_LAST_36 1, 0, 0, 0, 1, 1
+#define SORTNET_LAST_37 1, 0, 0, 1, 0, 0
+#define SORTNET_LAST_38 1, 0, 0, 1, 0, 1
+#define SORTNET_LAST_39 1, 0, 0, 1, 1, 0
+#define SORTNET_LAST_40 1, 0, 0, 1, 1, 1
+#define SORTNET_LAST_41 1, 0, 1, 0, 0, 0
+#define SORTNET_LAST_42 1, 0, 1, 0, 0, 1
+#define SORTNET_LAST_43 1, 0, 1, 0, 1, 0
+#define SORTNET_LAST_44 1, 0, 1, 0, 1, 1
+#define SORTNET_LAST_45 1, 0, 1, 1, 0, 0
+#define SORTNET_LAST_46 1, 0, 1, 1, 0, 1
+#define SORTNET_LAST_47 1, 0, 1, 1, 1, 0
+#define SORTNET_LAST_48 1, 0, 1, 1, 1, 1
+#define SORTNET_LAST_49 1, 1, 0, 0, 0, 0
+#define SORTNET_LAST_50 1, 1, 0, 0, 0, 1
+#define SORTNET_LAST_51 1, 1, 0, 0, 1, 0
+#define SORTNET_LAST_52 1, 1, 0, 0, 1, 1
+#define SORTNET_LAST_53 1, 1, 0, 1, 0, 0
+#define SORTNET_LAST_54 1, 1, 0, 1, 0, 1
+#define SORTNET_LAST_55 1, 1, 0, 1, 1, 0
+#define SORTNET_LAST_56 1, 1, 0, 1, 1, 1
+#define SORTNET_LAST_57 1, 1, 1, 0, 0, 0
+#define SORTNET_LAST_58 1, 1, 1, 0, 0, 1
+#define SORTNET_LAST_59 1, 1, 1, 0, 1, 0
+#define SORTNET_LAST_60 1, 1, 1, 0, 1, 1
+#define SORTNET_LAST_61 1, 1, 1, 1, 0, 0
+#define SORTNET_LAST_62 1, 1, 1, 1, 0, 1
+#define SORTNET_LAST_63 1, 1, 1, 1, 1, 0
+#define SORTNET_LAST_64 1, 1, 1, 1, 1, 1
+/* clang-format on */
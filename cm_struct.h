@@ -0,0 +1,127 @@
+/**
+ * @file cm_struct.h
+ * @brief Structs with serialization, equality and hashing, from a single list.
+ *
+ * @section struct_usage Usage
+ * `CM_STRUCT(Name, (int, id), (double, price))` declares:
+ *
+ * @code
+ * struct Name { int id; double price; };
+ * enum { Name_SIZE = sizeof(int) + sizeof(double) };
+ * static inline size_t Name_serialize(const struct Name *v,
+ *                                     unsigned char *buf);
+ * static inline size_t Name_deserialize(struct Name *v,
+ *                                       const unsigned char *buf);
+ * static inline int Name_equal(const struct Name *a, const struct Name *b);
+ * static inline uint64_t Name_hash(const struct Name *v);
+ * @endcode
+ *
+ * `Name_serialize` writes the fields one after another, without padding, into
+ * `Name_SIZE` bytes of `buf`, and returns `Name_SIZE`. `Name_deserialize`
+ * reads them back. `Name_equal` returns 1 if every field of `a` has the same
+ * value bytes as in `b`, `Name_hash` is the 64-bit FNV-1a of the value bytes.
+ *
+ * Value bytes of a field are all of its bytes, except for the padding of an
+ * x87 `long double`, which has 10 value bytes in 16 (or 12) bytes of storage.
+ * That padding is never compared or hashed, and is serialized as zeros. This
+ * needs C11 `_Generic` or C++: in C99, `long double` fields are compared by
+ * all of their bytes, so equal values can differ.
+ *
+ * Every function is a sequence of statements, one per field, with sizes and
+ * offsets known at compile time, expanded by `FOREACH`. There is no table of
+ * fields to walk at run time, so the compiler can inline, merge and vectorize
+ * copies and comparisons of adjacent fields.
+ *
+ * Field types shall not contain commas and shall be written before the name,
+ * so arrays need a typedef. Fields are copied as they are in memory, so
+ * serialized data is only portable between machines with the same byte order
+ * and type sizes, and pointers are not followed. Floating point fields are
+ * compared and hashed by their bytes, so `-0.0` differs from `0.0`, and a NaN
+ * equals itself. Padding inside struct or union fields is compared, hashed and
+ * serialized like any other byte, so such fields shall be zeroed (e.g. with
+ * `memset`) before they are assigned.
+ */
+#pragma once
+#include <float.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "macro_helpers.h"
+
+#define CM_STRUCT(name, ...)                                                   \
+  struct name {                                                                \
+    FOREACH(CM_STRUCT_MEMBER, __VA_ARGS__)                                     \
+  };                                                                           \
+  enum { name##_SIZE = 0 FOREACH(CM_STRUCT_SIZE, __VA_ARGS__) };               \
+  static inline size_t name##_serialize(const struct name *v,                  \
+                                        unsigned char *buf) {                  \
+    unsigned char *p = buf;                                                    \
+    FOREACH(CM_STRUCT_PUT, __VA_ARGS__)                                        \
+    return (size_t)(p - buf);                                                  \
+  }                                                                            \
+  static inline size_t name##_deserialize(struct name *v,                      \
+                                          const unsigned char *buf) {          \
+    const unsigned char *p = buf;                                              \
+    FOREACH(CM_STRUCT_GET, __VA_ARGS__)                                        \
+    return (size_t)(p - buf);                                                  \
+  }                                                                            \
+  static inline int name##_equal(const struct name *a,                         \
+                                 const struct name *b) {                       \
+    return 1 FOREACH(CM_STRUCT_EQUAL, __VA_ARGS__);                            \
+  }                                                                            \
+  static inline uint64_t name##_hash(const struct name *v) {                   \
+    uint64_t h = 14695981039346656037u;                                        \
+    FOREACH(CM_STRUCT_HASH, __VA_ARGS__)                                       \
+    return h;                                                                  \
+  }
+
+/* each is applied to a (type, field) pair */
+#define CM_STRUCT_MEMBER(x) CM_STRUCT_MEMBER_ x
+#define CM_STRUCT_MEMBER_(type, field) type field;
+#define CM_STRUCT_SIZE(x) CM_STRUCT_SIZE_ x
+#define CM_STRUCT_SIZE_(type, field) +sizeof(type)
+#define CM_STRUCT_PUT(x) CM_STRUCT_PUT_ x
+#define CM_STRUCT_PUT_(type, field)                                            \
+  memcpy(p, &v->field, CM_STRUCT_VALUE_SIZE(v->field));                        \
+  memset(p + CM_STRUCT_VALUE_SIZE(v->field), 0,                                \
+         sizeof(type) - CM_STRUCT_VALUE_SIZE(v->field));                       \
+  p += sizeof(type);
+#define CM_STRUCT_GET(x) CM_STRUCT_GET_ x
+#define CM_STRUCT_GET_(type, field)                                            \
+  memcpy(&v->field, p, sizeof(type));                                          \
+  p += sizeof(type);
+#define CM_STRUCT_EQUAL(x) CM_STRUCT_EQUAL_ x
+#define CM_STRUCT_EQUAL_(type, field)                                          \
+  &&memcmp(&a->field, &b->field, CM_STRUCT_VALUE_SIZE(a->field)) == 0
+#define CM_STRUCT_HASH(x) CM_STRUCT_HASH_ x
+#define CM_STRUCT_HASH_(type, field)                                           \
+  h = cm_struct_hash(h, &v->field, CM_STRUCT_VALUE_SIZE(v->field));
+
+/* number of leading bytes of `x` that hold its value */
+#if LDBL_MANT_DIG == 64 && (defined(__i386__) || defined(__x86_64__))
+#define CM_STRUCT_LDBL_SIZE ((size_t)10)
+#else
+#define CM_STRUCT_LDBL_SIZE sizeof(long double)
+#endif
+
+#if defined(__cplusplus)
+template <typename T> static inline size_t cm_struct_value_size(const T &) {
+  return sizeof(T);
+}
+static inline size_t cm_struct_value_size(const long double &) {
+  return CM_STRUCT_LDBL_SIZE;
+}
+#define CM_STRUCT_VALUE_SIZE(x) cm_struct_value_size(x)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define CM_STRUCT_VALUE_SIZE(x)                                                \
+  _Generic((x), long double: CM_STRUCT_LDBL_SIZE, default: sizeof(x))
+#else
+#define CM_STRUCT_VALUE_SIZE(x) sizeof(x)
+#endif
+
+static inline uint64_t cm_struct_hash(uint64_t h, const void *data,
+                                      size_t size) {
+  const unsigned char *p = (const unsigned char *)data;
+  for (; size; size--, p++) h = (h ^ *p) * 1099511628211u;
+  return h;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file cm_tables.h
+ * @brief Lookup tables generated at preprocessing time.
+ *
+ * @section tables_usage Usage
+ * Each macro expands to a comma separated list of 256 integer literals, to be
+ * used as an initializer. Example:
+ *
+ * @code
+ * #include "cm_tables.h"
+ *
+ * static const uint8_t popcount8[256] = {TABLE_POPCOUNT8()};
+ * static const uint32_t crc32[256] = {TABLE_CRC32()};
+ * static const int16_t sin_q15[256] = {TABLE_SIN_Q15()};
+ * @endcode
+ *
+ * - `TABLE_POPCOUNT8()`: number of set bits of `i`.
+ * - `TABLE_CRC32()`: CRC-32 (reflected polynomial `0xEDB88320`) of byte `i`,
+ *   as used by zlib.
+ * - `TABLE_SIN_Q15()`: `sin(2 * pi * i / 256)` in Q15, i.e. multiplied by
+ *   32767 and rounded. Computed with `cm_arith.h` in 6 digit fixed point, so
+ *   an entry may differ from the one computed with `double` by 1.
+ *
+ * `TABLE(gen, ctx)` builds a table of any other function of a byte: it runs
+ * one CM iteration per entry, from 255 down to 0, and emits `gen(ctx, b7, ...,
+ * b0)` with `CM_EMIT`, which puts entries back in ascending order. Bits of `i`
+ * are kept in the state, so `gen` can use them directly, see `TABLE_CRC32`.
+ * `ctx` is passed as is, e.g. `TABLE_SIN_Q15` computes a quarter of the sine
+ * wave with another CM beforehand, and passes it to `TABLE` to be indexed.
+ *
+ * @note `gen` is invoked from within a transition function, so it shall not
+ * use `CM`.
+ */
+#pragma once
+#include "cm_arith.h"
+
+#define TABLE(gen, ctx)                                                        \
+  CM(TABLE_STEP, (gen, ctx, EMPTY), 1, 1, 1, 1, 1, 1, 1, 1)
+
+/* state is (gen, ctx, sep), where sep is EMPTY for the last entry */
+#define CM_TABLE_STEP(p, f, state, ...)                                        \
+  CM_EMIT((TABLE_ENTRY(EXPAND state, __VA_ARGS__)), ,                          \
+          IF(TABLE_IS_ZERO(__VA_ARGS__))(EXIT, f), TABLE_NEXT_STATE state,     \
+          TABLE_DEC(__VA_ARGS__))
+#define TABLE_ENTRY(...) TABLE_ENTRY_(__VA_ARGS__)
+#define TABLE_ENTRY_(gen, ctx, sep, ...) gen(ctx, __VA_ARGS__) sep()
+#define TABLE_NEXT_STATE(gen, ctx, sep) (gen, ctx, COMMA)
+
+#define TABLE_IS_ZERO(...) CHECK(CAT(TABLE_IS_ZERO_, DIGITS_CAT(__VA_ARGS__)))
+#define TABLE_IS_ZERO_00000000 ~, 1,
+
+/* binary decrement, most significant bit first */
+#define TABLE_DEC(b7, b6, b5, b4, b3, b2, b1, b0)                              \
+  IIF(b0)(EXPAND, TABLE_DEC_7)(b7, b6, b5, b4, b3, b2, b1), COMPL(b0)
+#define TABLE_DEC_7(b6, b5, b4, b3, b2, b1, b0)                                \
+  IIF(b0)(EXPAND, TABLE_DEC_6)(b6, b5, b4, b3, b2, b1), COMPL(b0)
+#define TABLE_DEC_6(b5, b4, b3, b2, b1, b0)                                    \
+  IIF(b0)(EXPAND, TABLE_DEC_5)(b5, b4, b3, b2, b1), COMPL(b0)
+#define TABLE_DEC_5(b4, b3, b2, b1, b0)                                        \
+  IIF(b0)(EXPAND, TABLE_DEC_4)(b4, b3, b2, b1), COMPL(b0)
+#define TABLE_DEC_4(b3, b2, b1, b0)                                            \
+  IIF(b0)(EXPAND, TABLE_DEC_3)(b3, b2, b1), COMPL(b0)
+#define TABLE_DEC_3(b2, b1, b0) IIF(b0)(EXPAND, TABLE_DEC_2)(b2, b1), COMPL(b0)
+#define TABLE_DEC_2(b1, b0) IIF(b0)(EXPAND, TABLE_DEC_1)(b1), COMPL(b0)
+#define TABLE_DEC_1(b0) COMPL(b0)
+
+/* popcount */
+
+#define TABLE_POPCOUNT8() TABLE(TABLE_POPCOUNT, )
+#define TABLE_POPCOUNT(ctx, b7, b6, b5, b4, b3, b2, b1, b0)                    \
+  ARITH_SECOND(CAT(DIGIT_SUM_,                                                 \
+                   PP_NARG(~ CAT(DIGIT_UNARY_, b7) CAT(DIGIT_UNARY_, b6)       \
+                               CAT(DIGIT_UNARY_, b5) CAT(DIGIT_UNARY_, b4)     \
+                               CAT(DIGIT_UNARY_, b3) CAT(DIGIT_UNARY_, b2)     \
+                               CAT(DIGIT_UNARY_, b1) CAT(DIGIT_UNARY_, b0))))
+
+/* CRC-32: 8 rounds of shifting right and xoring with the polynomial if the
+ * shifted out bit was set, on 32 bits, most significant first */
+
+#define TABLE_CRC32() TABLE(TABLE_CRC, )
+#define TABLE_CRC(ctx, ...)                                                    \
+  TABLE_CRC_HEX(TABLE_CRC_ROUND(TABLE_CRC_ROUND(TABLE_CRC_ROUND(               \
+      TABLE_CRC_ROUND(TABLE_CRC_ROUND(TABLE_CRC_ROUND(TABLE_CRC_ROUND(         \
+          TABLE_CRC_ROUND(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   \
+                          0, 0, 0, 0, 0, 0, 0, __VA_ARGS__)))))))))
+
+#define TABLE_CRC_ROUND(...) TABLE_CRC_ROUND_(__VA_ARGS__)
+#define TABLE_CRC_ROUND_(c31, c30, c29, c28, c27, c26, c25, c24, c23, c22,     \
+                         c21, c20, c19, c18, c17, c16, c15, c14, c13, c12,     \
+                         c11, c10, c9, c8, c7, c6, c5, c4, c3, c2, c1, c0)     \
+  IIF(c0)(TABLE_CRC_XOR, EXPAND)(0, c31, c30, c29, c28, c27, c26, c25, c24,    \
+                                 c23, c22, c21, c20, c19, c18, c17, c16, c15,  \
+                                 c14, c13, c12, c11, c10, c9, c8, c7, c6, c5,  \
+                                 c4, c3, c2, c1)
+
+/* xor with 0xEDB88320 */
+#define TABLE_CRC_XOR(c31, c30, c29, c28, c27, c26, c25, c24, c23, c22, c21,   \
+                      c20, c19, c18, c17, c16, c15, c14, c13, c12, c11, c10,   \
+                      c9, c8, c7, c6, c5, c4, c3, c2, c1, c0)                  \
+  COMPL(c31), COMPL(c30), COMPL(c29), c28, COMPL(c27), COMPL(c26), c25,        \
+      COMPL(c24), COMPL(c23), c22, COMPL(c21), COMPL(c20), COMPL(c19), c18,    \
+      c17, c16, COMPL(c15), c14, c13, c12, c11, c10, COMPL(c9), COMPL(c8), c7, \
+      c6, COMPL(c5), c4, c3, c2, c1, c0
+
+#define TABLE_CRC_HEX(...) TABLE_CRC_HEX_(__VA_ARGS__)
+#define TABLE_CRC_HEX_(c31, c30, c29, c28, c27, c26, c25, c24, c23, c22, c21,  \
+                       c20, c19, c18, c17, c16, c15, c14, c13, c12, c11, c10,  \
+                       c9, c8, c7, c6, c5, c4, c3, c2, c1, c0)                 \
+  CAT(0x, DIGITS_CAT(TABLE_HEX(c31, c30, c29, c28),                            \
+                     TABLE_HEX(c27, c26, c25, c24),                            \
+                     TABLE_HEX(c23, c22, c21, c20),                            \
+                     TABLE_HEX(c19, c18, c17, c16),                            \
+                     TABLE_HEX(c15, c14, c13, c12),                            \
+                     TABLE_HEX(c11, c10, c9, c8), TABLE_HEX(c7, c6, c5, c4),   \
+                     TABLE_HEX(c3, c2, c1, c0)))
+
+#define TABLE_HEX(a, b, c, d) TABLE_HEX_##a##b##c##d
+/* clang-format off */
+#define TABLE_HEX_0000 0
+#define TABLE_HEX_0001 1
+#define TABLE_HEX_0010 2
+#define TABLE_HEX_0011 3
+#define TABLE_HEX_0100 4
+#define TABLE_HEX_0101 5
+#define TABLE_HEX_0110 6
+#define TABLE_HEX_0111 7
+#define TABLE_HEX_1000 8
+#define TABLE_HEX_1001 9
+#define TABLE_HEX_1010 A
+#define TABLE_HEX_1011 B
+#define TABLE_HEX_1100 C
+#define TABLE_HEX_1101 D
+#define TABLE_HEX_1110 E
+#define TABLE_HEX_1111 F
+/* clang-format on */
+
+/* sine: values for angles 0 ... 64 (in steps of pi / 128) are computed first,
+ * and every entry picks one of them: b7 is the sign, b6 selects the rising or
+ * the falling half of the wave, and b5 ... b0 is the angle k (or 64 - k) */
+
+#define TABLE_SIN_Q15()                                                        \
+  TABLE(TABLE_SIN, (CM(TABLE_SIN_QUARTER, ARITH(6, 4), EMPTY)))
+#define TABLE_SIN(quarter, b7, b6, ...)                                        \
+  TABLE_SIN_SIGN(b7, IIF(b6)(TABLE_SIN_FALLING, TABLE_PICK)(__VA_ARGS__,       \
+                                                            EXPAND quarter))
+#define TABLE_SIN_SIGN(negative, v) IIF(negative)(IIF(NOT(v))(, -), ) v
+/* 64 - k = 1 + (63 - k) */
+#define TABLE_SIN_FALLING(...) TABLE_SIN_FALLING_(__VA_ARGS__)
+#define TABLE_SIN_FALLING_(b5, b4, b3, b2, b1, b0, q0, ...)                    \
+  TABLE_PICK(COMPL(b5), COMPL(b4), COMPL(b3), COMPL(b2), COMPL(b1),            \
+             COMPL(b0), __VA_ARGS__)
+
+/* counts k down, so that the values are emitted in ascending order */
+#define CM_TABLE_SIN_QUARTER(p, f, k, sep)                                     \
+  CM_EMIT((TABLE_SIN_Q15_OF(k) sep()), , IF(ARITH_IS_ZERO(k))(EXIT, f),        \
+          ARITH_DEC(k), COMMA)
+
+/* element k of a list, where k is given by 6 bits before it */
+#define TABLE_PICK(...) TABLE_PICK_(__VA_ARGS__)
+#define TABLE_PICK_(b5, b4, b3, b2, b1, b0, ...)                               \
+  TABLE_FIRST(IIF(b0)(TABLE_DROP_1, EXPAND)(IIF(b1)(TABLE_DROP_2, EXPAND)(     \
+      IIF(b2)(TABLE_DROP_4, EXPAND)(IIF(b3)(TABLE_DROP_8, EXPAND)(             \
+          IIF(b4)(TABLE_DROP_16, EXPAND)(IIF(b5)(TABLE_DROP_32, EXPAND)(       \
+              __VA_ARGS__)))))))
+#define TABLE_FIRST(...) FIRST_ARG(__VA_ARGS__)
+#define TABLE_DROP_1(...) TABLE_DROP_1_(__VA_ARGS__)
+#define TABLE_DROP_1_(x, ...) __VA_ARGS__
+#define TABLE_DROP_2(...) TABLE_DROP_1(TABLE_DROP_1(__VA_ARGS__))
+#define TABLE_DROP_4(...) TABLE_DROP_2(TABLE_DROP_2(__VA_ARGS__))
+#define TABLE_DROP_8(...) TABLE_DROP_4(TABLE_DROP_4(__VA_ARGS__))
+#define TABLE_DROP_16(...) TABLE_DROP_8(TABLE_DROP_8(__VA_ARGS__))
+#define TABLE_DROP_32(...) TABLE_DROP_16(TABLE_DROP_16(__VA_ARGS__))
+
+/* x = k * pi / 128, sin x = x (1 - x^2 / 6 (1 - x^2 / 20 (1 - x^2 / 42 (1 -
+ * x^2 / 72 (1 - x^2 / 110))))), rounded to Q15. Divisions are done as
+ * multiplications by reciprocals, all in 6 digit fixed point. */
+#define TABLE_SIN_Q15_OF(k)                                                    \
+  TABLE_SIN_X(ARITH_UNSHIFT(ARITH_MUL(k, ARITH(2, 4, 5, 4, 3, 7))))
+#define TABLE_SIN_X(x) TABLE_SIN_X2(x, ARITH_MUL_FIXED(x, x))
+#define TABLE_SIN_X2(x, x2)                                                    \
+  TABLE_SIN_ROUND(ARITH_MUL_FIXED(                                             \
+      x, TABLE_SIN_TERM(x2, ARITH(1, 6, 6, 6, 6, 7),                           \
+                        TABLE_SIN_TERM(x2, ARITH(5, 0, 0, 0, 0),               \
+                                       TABLE_SIN_TERM(x2, ARITH(2, 3, 8, 1, 0),\
+                                                      TABLE_SIN_TERM(          \
+                                                          x2,                  \
+                                                          ARITH(1, 3, 8, 8, 9),\
+                                                          TABLE_SIN_LAST(      \
+                                                              x2)))))))
+/* 1 - x^2 * r * t, where r is a reciprocal */
+#define TABLE_SIN_TERM(x2, r, t)                                               \
+  ARITH_SUB(ARITH(1, 0, 0, 0, 0, 0, 0),                                        \
+            ARITH_MUL_FIXED(r, ARITH_MUL_FIXED(x2, t)))
+#define TABLE_SIN_LAST(x2)                                                     \
+  ARITH_SUB(ARITH(1, 0, 0, 0, 0, 0, 0),                                        \
+            ARITH_MUL_FIXED(ARITH(9, 0, 9, 1), x2))
+/* s * 32767 / 10^6, rounded */
+#define TABLE_SIN_ROUND(s)                                                     \
+  ARITH_TO_NUMBER(ARITH_UNSHIFT(                                               \
+      ARITH_ADD(ARITH_MUL_FIXED(s, ARITH(3, 2, 7, 6, 7, 0)), ARITH(5))))
@@ -0,0 +1,164 @@
+/**
+ * @file cm_unroll.h
+ * @brief Loops and lane lists unrolled at preprocessing time.
+ *
+ * @section unroll_usage Usage
+ * `CM_UNROLL_LOOP(n, i, body)` expands to `n` copies of `body`, each in a
+ * block of its own, where `i` is an enumerator equal to the index of the copy,
+ * from `0` to `n - 1`. Thus `i` is an integer constant expression, which
+ * folds into array indices and shifts like a literal would. Example:
+ *
+ * @code
+ * #include "cm_unroll.h"
+ *
+ * uint32_t checksum(const uint8_t block[64]) {
+ *   uint32_t sum = 0;
+ *   CM_UNROLL_LOOP(64, i, sum += (uint32_t)block[i] << (i % 4 * 8);)
+ *   return sum;
+ * }
+ * @endcode
+ *
+ * expands to
+ *
+ * @code
+ * { enum { i = 0 }; sum += (uint32_t)block[i] << (i % 4 * 8); }
+ * { enum { i = 1 }; sum += (uint32_t)block[i] << (i % 4 * 8); }
+ * ...
+ * { enum { i = 63 }; sum += (uint32_t)block[i] << (i % 4 * 8); }
+ * @endcode
+ *
+ * `CM_UNROLL_DUFF(n, count, body)` runs `body` `count` times, where `count` is
+ * any expression, evaluated once, with Duff's device: a loop over `n` copies
+ * of `body`, entered through a `switch` on `count % n` at the copy that leaves
+ * the remainder to be done in the first pass, so there is no loop for the
+ * remainder. Example:
+ *
+ * @code
+ * void copy(int *to, const int *from, size_t count) {
+ *   CM_UNROLL_DUFF(8, count, *to++ = *from++;)
+ * }
+ * @endcode
+ *
+ * `CM_LANES(width, expr)` expands to `expr(0), expr(1), ..., expr(width - 1)`,
+ * and `CM_LANES_REVERSED(width, expr)` to the same list, from the last lane,
+ * for intrinsics like `_mm256_set_epi32`, which take it in that order. `expr`
+ * is a function-like macro, which gets the index as a decimal literal, so
+ * that shuffle masks and permutations can be written as a formula of the
+ * lane. Example:
+ *
+ * @code
+ * #define ROTATE_LANE(i) (((i) + 1) % 8)
+ *
+ * // rotates 8 lanes of 32 bits by one, same as
+ * // _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1)
+ * __m256i rotate = _mm256_set_epi32(CM_LANES_REVERSED(8, ROTATE_LANE));
+ * typedef int v8si __attribute__((vector_size(32)));
+ * v8si mask = {CM_LANES(8, ROTATE_LANE)};
+ * @endcode
+ *
+ * `n` and `width` shall be decimal literals from `0` to `999` (from `1` for
+ * `CM_UNROLL_DUFF`), as their digits are looked up in `cm_unroll_counts.h`,
+ * which `tools/gen_unroll_counts.py -n <limit>` regenerates for more of them
+ * (up to `10^8`). `body` may contain commas. Copies are made with one `CM`
+ * iteration each, so `n` is only limited by the size of that table and by
+ * `CM_MAX_LEVEL`, unlike lists counted with `PP_NARG`. Any other `n` or
+ * `width`, such as `07` or `1000`, invokes `CM_ERROR_UNSUPPORTED_UNROLL_COUNT`
+ * with a wrong number of arguments, which fails preprocessing. `body` shall
+ * not use `break` or `continue`: in `CM_UNROLL_LOOP` they apply to the loop
+ * around it, if any, and in `CM_UNROLL_DUFF` to the loop or `switch` of the
+ * device.
+ *
+ * @note `body` and `expr` are invoked from within a transition function, so
+ * they shall not use `CM`.
+ */
+#pragma once
+#include <stddef.h>
+#include "cm_arith.h"
+#include "cm_unroll_counts.h"
+
+#define CM_UNROLL_LOOP(n, i, ...)                                              \
+  REPEAT_IF_COUNT(n, REPEAT)(n, (REPEAT_COPY, (i, __VA_ARGS__)))
+#define REPEAT(n, state) CM(REPEAT_STEP, state, REPEAT_COUNT(n))
+
+#define CM_UNROLL_DUFF(n, count, ...)                                          \
+  REPEAT_IF_COUNT(n, REPEAT_DUFF)(REPEAT_ID, n, count, __VA_ARGS__)
+/* `id` is expanded once, so that every use of a variable gets the same name,
+ * and a device in the body of another one does not shadow its variables */
+#define REPEAT_DUFF(id, n, count, ...)                                         \
+  {                                                                            \
+    size_t REPEAT_LEFT(id) = (count);                                          \
+    if (REPEAT_LEFT(id)) {                                                     \
+      size_t REPEAT_PASSES(id) = (REPEAT_LEFT(id) + (n) - 1) / (n);            \
+      switch (REPEAT_LEFT(id) % (n)) {                                         \
+        do {                                                                   \
+          REPEAT(n, (REPEAT_CASE, (n, __VA_ARGS__)))                           \
+        } while (--REPEAT_PASSES(id));                                         \
+      }                                                                        \
+    }                                                                          \
+  }
+#define REPEAT_LEFT(id) CAT(cm_unroll_left_, id)
+#define REPEAT_PASSES(id) CAT(cm_unroll_passes_, id)
+#ifdef __COUNTER__
+#define REPEAT_ID __COUNTER__
+#else
+#define REPEAT_ID __LINE__
+#endif
+
+#define CM_LANES(width, expr)                                                  \
+  REPEAT_IF_COUNT(width, REPEAT)(width, (REPEAT_LANE, (expr)))
+#define CM_LANES_REVERSED(width, expr)                                         \
+  REPEAT_IF_COUNT(width, REPEAT_LANES_REVERSED)(width, expr)
+#define REPEAT_LANES_REVERSED(width, expr)                                     \
+  REPEAT(width, (REPEAT_LANE_REVERSED, (expr, REPEAT_LAST(width))))
+
+/* state is (gen, ctx), the argument is the number of copies left. Copies are
+ * made from the last one, so that CM_EMIT puts them in order. `gen` gets the
+ * index as a cm_arith.h number. */
+#define CM_REPEAT_STEP(p, f, state, n)                                         \
+  IIF(ARITH_IS_ZERO(n))(REPEAT_DONE, REPEAT_EMIT)(f, state, ARITH_DEC(n))
+#define REPEAT_DONE(f, state, k) (, EXIT, state)
+#define REPEAT_EMIT(f, state, k)                                               \
+  CM_EMIT((REPEAT_GEN(EXPAND state, k)), , f, state, k)
+#define REPEAT_GEN(...) REPEAT_GEN_(__VA_ARGS__)
+#define REPEAT_GEN_(gen, ctx, k) REPEAT_APPLY(gen, k, EXPAND ctx)
+#define REPEAT_APPLY(gen, ...) gen(__VA_ARGS__)
+
+#define REPEAT_COPY(k, i, ...)                                                 \
+  {                                                                            \
+    enum { i = ARITH_TO_NUMBER(k) };                                           \
+    __VA_ARGS__                                                                \
+  }
+/* copy k of a pass is entered when n - k copies are left, counting it */
+#define REPEAT_CASE(k, n, ...)                                                 \
+  REPEAT_FALLTHROUGH                                                           \
+  case (n - ARITH_TO_NUMBER(k)) % n:                                           \
+    __VA_ARGS__
+
+/* lanes are separated by commas, which come before all but the first one */
+#define REPEAT_LANE(k, expr)                                                   \
+  IIF(ARITH_IS_ZERO(k))(EMPTY, COMMA)() expr(ARITH_TO_NUMBER(k))
+#define REPEAT_LANE_REVERSED(k, expr, last)                                    \
+  IIF(ARITH_IS_ZERO(k))(EMPTY, COMMA)()                                        \
+  expr(ARITH_TO_NUMBER(ARITH_SUB(last, k)))
+#define REPEAT_LAST(n) ARITH_DEC(REPEAT_COUNT(n))
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+#define REPEAT_FALLTHROUGH [[fallthrough]];
+#elif defined(__has_attribute)
+#if __has_attribute(fallthrough)
+#define REPEAT_FALLTHROUGH __attribute__((fallthrough));
+#endif
+#endif
+#ifndef REPEAT_FALLTHROUGH
+#define REPEAT_FALLTHROUGH
+#endif
+
+/* invokes `f` if REPEAT_N_n is defined, i.e. expands to parenthesized digits,
+ * and the error otherwise, before anything is counted */
+#define REPEAT_IF_COUNT(n, f)                                                  \
+  IIF(REPEAT_IS_COUNT(CAT(REPEAT_N_, n)))(f, CM_ERROR_UNSUPPORTED_UNROLL_COUNT)
+#define REPEAT_IS_COUNT(digits) CHECK(REPEAT_PROBE digits)
+#define REPEAT_PROBE(...) ~, 1,
+#define CM_ERROR_UNSUPPORTED_UNROLL_COUNT() /* NOTE: if you see this in your error output, n of CM_UNROLL_LOOP, CM_UNROLL_DUFF or CM_LANES is not in cm_unroll_counts.h. */
+#define REPEAT_COUNT(n) REPEAT_COUNT_(CAT(REPEAT_N_, n))
+#define REPEAT_COUNT_(digits) ARITH digits
@@ -0,0 +1,1010 @@
+/**
+ * @file cm_unroll_counts.h
+ * @brief Digits of counts 0 ... 999 for cm_unroll.h.
+ *
+ * Generated by tools/gen_unroll_counts.py. Do not edit.
+ */
+#pragma once
+
+/* clang-format off */
+#define REPEAT_N_0 (0)
+#define REPEAT_N_1 (1)
+#define REPEAT_N_2 (2)
+#define REPEAT_N_3 (3)
+#define REPEAT_N_4 (4)
+#define REPEAT_N_5 (5)
+#define REPEAT_N_6 (6)
+#define REPEAT_N_7 (7)
+#define REPEAT_N_8 (8)
+#define REPEAT_N_9 (9)
+#define REPEAT_N_10 (1, 0)
+#define REPEAT_N_11 (1, 1)
+#define REPEAT_N_12 (1, 2)
+#define REPEAT_N_13 (1, 3)
+#define REPEAT_N_14 (1, 4)
+#define REPEAT_N_15 (1, 5)
+#define REPEAT_N_16 (1, 6)
+#define REPEAT_N_17 (1, 7)
+#define REPEAT_N_18 (1, 8)
+#define REPEAT_N_19 (1, 9)
+#define REPEAT_N_20 (2, 0)
+#define REPEAT_N_21 (2, 1)
+#define REPEAT_N_22 (2, 2)
+#define REPEAT_N_23 (2, 3)
+#define REPEAT_N_24 (2, 4)
+#define REPEAT_N_25 (2, 5)
+#define REPEAT_N_26 (2, 6)
+#define REPEAT_N_27 (2, 7)
+#define REPEAT_N_28 (2, 8)
+#define REPEAT_N_29 (2, 9)
+#define REPEAT_N_30 (3, 0)
+#define REPEAT_N_31 (3, 1)
+#define REPEAT_N_32 (3, 2)
+#define REPEAT_N_33 (3, 3)
+#define REPEAT_N_34 (3, 4)
+#define REPEAT_N_35 (3, 5)
+#define REPEAT_N_36 (3, 6)
+#define REPEAT_N_37 (3, 7)
+#define REPEAT_N_38 (3, 8)
+#define REPEAT_N_39 (3, 9)
+#define REPEAT_N_40 (4, 0)
+#define REPEAT_N_41 (4, 1)
+#define REPEAT_N_42 (4, 2)
+#define REPEAT_N_43 (4, 3)
+#define REPEAT_N_44 (4, 4)
+#define REPEAT_N_45 (4, 5)
+#define REPEAT_N_46 (4, 6)
+#define REPEAT_N_47 (4, 7)
+#define REPEAT_N_48 (4, 8)
+#define REPEAT_N_49 (4, 9)
+#define REPEAT_N_50 (5, 0)
+#define REPEAT_N_51 (5, 1)
+#define REPEAT_N_52 (5, 2)
+#define REPEAT_N_53 (5, 3)
+#define REPEAT_N_54 (5, 4)
+#define REPEAT_N_55 (5, 5)
+#define REPEAT_N_56 (5, 6)
+#define REPEAT_N_57 (5, 7)
+#define REPEAT_N_58 (5, 8)
+#define REPEAT_N_59 (5, 9)
+#define REPEAT_N_60 (6, 0)
+#define REPEAT_N_61 (6, 1)
+#define REPEAT_N_62 (6, 2)
+#define REPEAT_N_63 (6, 3)
+#define REPEAT_N_64 (6, 4)
+#define REPEAT_N_65 (6, 5)
+#define REPEAT_N_66 (6, 6)
+#define REPEAT_N_67 (6, 7)
+#define REPEAT_N_68 (6, 8)
+#define REPEAT_N_69 (6, 9)
+#define REPEAT_N_70 (7, 0)
+#define REPEAT_N_71 (7, 1)
+#define REPEAT_N_72 (7, 2)
+#define REPEAT_N_73 (7, 3)
+#define REPEAT_N_74 (7, 4)
+#define REPEAT_N_75 (7, 5)
+#define REPEAT_N_76 (7, 6)
+#define REPEAT_N_77 (7, 7)
+#define REPEAT_N_78 (7, 8)
+#define REPEAT_N_79 (7, 9)
+#define REPEAT_N_80 (8, 0)
+#define REPEAT_N_81 (8, 1)
+#define REPEAT_N_82 (8, 2)
+#define REPEAT_N_83 (8, 3)
+#define REPEAT_N_84 (8, 4)
+#define REPEAT_N_85 (8, 5)
+#define REPEAT_N_86 (8, 6)
+#define REPEAT_N_87 (8, 7)
+#define REPEAT_N_88 (8, 8)
+#define REPEAT_N_89 (8, 9)
+#define REPEAT_N_90 (9, 0)
+#define REPEAT_N_91 (9, 1)
+#define REPEAT_N_92 (9, 2)
+#define REPEAT_N_93 (9, 3)
+#define REPEAT_N_94 (9, 4)
+#define REPEAT_N_95 (9, 5)
+#define REPEAT_N_96 (9, 6)
+#define REPEAT_N_97 (9, 7)
+#define REPEAT_N_98 (9, 8)
+#define REPEAT_N_99 (9, 9)
+#define REPEAT_N_100 (1, 0, 0)
+#define REPEAT_N_101 (1, 0, 1)
+#define REPEAT_N_102 (1, 0, 2)
+#define REPEAT_N_103 (1, 0, 3)
+#define REPEAT_N_104 (1, 0, 4)
+#define REPEAT_N_105 (1, 0, 5)
+#define REPEAT_N_106 (1, 0, 6)
+#define REPEAT_N_107 (1, 0, 7)
+#define REPEAT_N_108 (1, 0, 8)
+#define REPEAT_N_109 (1, 0, 9)
+#define REPEAT_N_110 (1, 1, 0)
+#define REPEAT_N_111 (1, 1, 1)
+#define REPEAT_N_112 (1, 1, 2)
+#define REPEAT_N_113 (1, 1, 3)
+#define REPEAT_N_114 (1, 1, 4)
+#define REPEAT_N_115 (1, 1, 5)
+#define REPEAT_N_116 (1, 1, 6)
+#define REPEAT_N_117 (1, 1, 7)
+#define REPEAT_N_118 (1, 1, 8)
+#define REPEAT_N_119 (1, 1, 9)
+#define REPEAT_N_120 (1, 2, 0)
+#define REPEAT_N_121 (1, 2, 1)
+#define REPEAT_N_122 (1, 2, 2)
+#define REPEAT_N_123 (1, 2, 3)
+#define REPEAT_N_124 (1, 2, 4)
+#define REPEAT_N_125 (1, 2, 5)
+#define REPEAT_N_126 (1, 2, 6)
+#define REPEAT_N_127 (1, 2, 7)
+#define REPEAT_N_128 (1, 2, 8)
+#define REPEAT_N_129 (1, 2, 9)
+#define REPEAT_N_130 (1, 3, 0)
+#define REPEAT_N_131 (1, 3, 1)
+#define REPEAT_N_132 (1, 3, 2)
+#define REPEAT_N_133 (1, 3, 3)
+#define REPEAT_N_134 (1, 3, 4)
+#define REPEAT_N_135 (1, 3, 5)
+#define REPEAT_N_136 (1, 3, 6)
+#define REPEAT_N_137 (1, 3, 7)
+#define REPEAT_N_138 (1, 3, 8)
+#define REPEAT_N_139 (1, 3, 9)
+#define REPEAT_N_140 (1, 4, 0)
+#define REPEAT_N_141 (1, 4, 1)
+#define REPEAT_N_142 (1, 4, 2)
+#define REPEAT_N_143 (1, 4, 3)
+#define REPEAT_N_144 (1, 4, 4)
+#define REPEAT_N_145 (1, 4, 5)
+#define REPEAT_N_146 (1, 4, 6)
+#define REPEAT_N_147 (1, 4, 7)
+#define REPEAT_N_148 (1, 4, 8)
+#define REPEAT_N_149 (1, 4, 9)
+#define REPEAT_N_150 (1, 5, 0)
+#define REPEAT_N_151 (1, 5, 1)
+#define REPEAT_N_152 (1, 5, 2)
+#define REPEAT_N_153 (1, 5, 3)
+#define REPEAT_N_154 (1, 5, 4)
+#define REPEAT_N_155 (1, 5, 5)
+#define REPEAT_N_156 (1, 5, 6)
+#define REPEAT_N_157 (1, 5, 7)
+#define REPEAT_N_158 (1, 5, 8)
+#define REPEAT_N_159 (1, 5, 9)
+#define REPEAT_N_160 (1, 6, 0)
+#define REPEAT_N_161 (1, 6, 1)
+#define REPEAT_N_162 (1, 6, 2)
+#define REPEAT_N_163 (1, 6, 3)
+#define REPEAT_N_164 (1, 6, 4)
+#define REPEAT_N_165 (1, 6, 5)
+#define REPEAT_N_166 (1, 6, 6)
+#define REPEAT_N_167 (1, 6, 7)
+#define REPEAT_N_168 (1, 6, 8)
+#define REPEAT_N_169 (1, 6, 9)
+#define REPEAT_N_170 (1, 7, 0)
+#define REPEAT_N_171 (1, 7, 1)
+#define REPEAT_N_172 (1, 7, 2)
+#define REPEAT_N_173 (1, 7, 3)
+#define REPEAT_N_174 (1, 7, 4)
+#define REPEAT_N_175 (1, 7, 5)
+#define REPEAT_N_176 (1, 7, 6)
+#define REPEAT_N_177 (1, 7, 7)
+#define REPEAT_N_178 (1, 7, 8)
+#define REPEAT_N_179 (1, 7, 9)
+#define REPEAT_N_180 (1, 8, 0)
+#define REPEAT_N_181 (1, 8, 1)
+#define REPEAT_N_182 (1, 8, 2)
+#define REPEAT_N_183 (1, 8, 3)
+#define REPEAT_N_184 (1, 8, 4)
+#define REPEAT_N_185 (1, 8, 5)
+#define REPEAT_N_186 (1, 8, 6)
+#define REPEAT_N_187 (1, 8, 7)
+#define REPEAT_N_188 (1, 8, 8)
+#define REPEAT_N_189 (1, 8, 9)
+#define REPEAT_N_190 (1, 9, 0)
+#define REPEAT_N_191 (1, 9, 1)
+#define REPEAT_N_192 (1, 9, 2)
+#define REPEAT_N_193 (1, 9, 3)
+#define REPEAT_N_194 (1, 9, 4)
+#define REPEAT_N_195 (1, 9, 5)
+#define REPEAT_N_196 (1, 9, 6)
+#define REPEAT_N_197 (1, 9, 7)
+#define REPEAT_N_198 (1, 9, 8)
+#define REPEAT_N_199 (1, 9, 9)
+#define REPEAT_N_200 (2, 0, 0)
+#define REPEAT_N_201 (2, 0, 1)
+#define REPEAT_N_202 (2, 0, 2)
+#define REPEAT_N_203 (2, 0, 3)
+#define REPEAT_N_204 (2, 0, 4)
+#define REPEAT_N_205 (2, 0, 5)
+#define REPEAT_N_206 (2, 0, 6)
+#define REPEAT_N_207 (2, 0, 7)
+#define REPEAT_N_208 (2, 0, 8)
+#define REPEAT_N_209 (2, 0, 9)
+#define REPEAT_N_210 (2, 1, 0)
+#define REPEAT_N_211 (2, 1, 1)
+#define REPEAT_N_212 (2, 1, 2)
+#define REPEAT_N_213 (2, 1, 3)
+#define REPEAT_N_214 (2, 1, 4)
+#define REPEAT_N_215 (2, 1, 5)
+#define REPEAT_N_216 (2, 1, 6)
+#define REPEAT_N_217 (2, 1, 7)
+#define REPEAT_N_218 (2, 1, 8)
+#define REPEAT_N_219 (2, 1, 9)
+#define REPEAT_N_220 (2, 2, 0)
+#define REPEAT_N_221 (2, 2, 1)
+#define REPEAT_N_222 (2, 2, 2)
+#define REPEAT_N_223 (2, 2, 3)
+#define REPEAT_N_224 (2, 2, 4)
+#define REPEAT_N_225 (2, 2, 5)
+#define REPEAT_N_226 (2, 2, 6)
+#define REPEAT_N_227 (2, 2, 7)
+#define REPEAT_N_228 (2, 2, 8)
+#define REPEAT_N_229 (2, 2, 9)
+#define REPEAT_N_230 (2, 3, 0)
+#define REPEAT_N_231 (2, 3, 1)
+#define REPEAT_N_232 (2, 3, 2)
+#define REPEAT_N_233 (2, 3, 3)
+#define REPEAT_N_234 (2, 3, 4)
+#define REPEAT_N_235 (2, 3, 5)
+#define REPEAT_N_236 (2, 3, 6)
+#define REPEAT_N_237 (2, 3, 7)
+#define REPEAT_N_238 (2, 3, 8)
+#define REPEAT_N_239 (2, 3, 9)
+#define REPEAT_N_240 (2, 4, 0)
+#define REPEAT_N_241 (2, 4, 1)
+#define REPEAT_N_242 (2, 4, 2)
+#define REPEAT_N_243 (2, 4, 3)
+#define REPEAT_N_244 (2, 4, 4)
+#define REPEAT_N_245 (2, 4, 5)
+#define REPEAT_N_246 (2, 4, 6)
+#define REPEAT_N_247 (2, 4, 7)
+#define REPEAT_N_248 (2, 4, 8)
+#define REPEAT_N_249 (2, 4, 9)
+#define REPEAT_N_250 (2, 5, 0)
+#define REPEAT_N_251 (2, 5, 1)
+#define REPEAT_N_252 (2, 5, 2)
+#define REPEAT_N_253 (2, 5, 3)
+#define REPEAT_N_254 (2, 5, 4)
+#define REPEAT_N_255 (2, 5, 5)
+#define REPEAT_N_256 (2, 5, 6)
+#define REPEAT_N_257 (2, 5, 7)
+#define REPEAT_N_258 (2, 5, 8)
+#define REPEAT_N_259 (2, 5, 9)
+#define REPEAT_N_260 (2, 6, 0)
+#define REPEAT_N_261 (2, 6, 1)
+#define REPEAT_N_262 (2, 6, 2)
+#define REPEAT_N_263 (2, 6, 3)
+#define REPEAT_N_264 (2, 6, 4)
+#define REPEAT_N_265 (2, 6, 5)
+#define REPEAT_N_266 (2, 6, 6)
+#define REPEAT_N_267 (2, 6, 7)
+#define REPEAT_N_268 (2, 6, 8)
+#define REPEAT_N_269 (2, 6, 9)
+#define REPEAT_N_270 (2, 7, 0)
+#define REPEAT_N_271 (2, 7, 1)
+#define REPEAT_N_272 (2, 7, 2)
+#define REPEAT_N_273 (2, 7, 3)
+#define REPEAT_N_274 (2, 7, 4)
+#define REPEAT_N_275 (2, 7, 5)
+#define REPEAT_N_276 (2, 7, 6)
+#define REPEAT_N_277 (2, 7, 7)
+#define REPEAT_N_278 (2, 7, 8)
+#define REPEAT_N_279 (2, 7, 9)
+#define REPEAT_N_280 (2, 8, 0)
+#define REPEAT_N_281 (2, 8, 1)
+#define REPEAT_N_282 (2, 8, 2)
+#define REPEAT_N_283 (2, 8, 3)
+#define REPEAT_N_284 (2, 8, 4)
+#define REPEAT_N_285 (2, 8, 5)
+#define REPEAT_N_286 (2, 8, 6)
+#define REPEAT_N_287 (2, 8, 7)
+#define REPEAT_N_288 (2, 8, 8)
+#define REPEAT_N_289 (2, 8, 9)
+#define REPEAT_N_290 (2, 9, 0)
+#define REPEAT_N_291 (2, 9, 1)
+#define REPEAT_N_292 (2, 9, 2)
+#define REPEAT_N_293 (2, 9, 3)
+#define REPEAT_N_294 (2, 9, 4)
+#define REPEAT_N_295 (2, 9, 5)
+#define REPEAT_N_296 (2, 9, 6)
+#define REPEAT_N_297 (2, 9, 7)
+#define REPEAT_N_298 (2, 9, 8)
+#define REPEAT_N_299 (2, 9, 9)
+#define REPEAT_N_300 (3, 0, 0)
+#define REPEAT_N_301 (3, 0, 1)
+#define REPEAT_N_302 (3, 0, 2)
+#define REPEAT_N_303 (3, 0, 3)
+#define REPEAT_N_304 (3, 0, 4)
+#define REPEAT_N_305 (3, 0, 5)
+#define REPEAT_N_306 (3, 0, 6)
+#define REPEAT_N_307 (3, 0, 7)
+#define REPEAT_N_308 (3, 0, 8)
+#define REPEAT_N_309 (3, 0, 9)
+#define REPEAT_N_310 (3, 1, 0)
+#define REPEAT_N_311 (3, 1, 1)
+#define REPEAT_N_312 (3, 1, 2)
+#define REPEAT_N_313 (3, 1, 3)
+#define REPEAT_N_314 (3, 1, 4)
+#define REPEAT_N_315 (3, 1, 5)
+#define REPEAT_N_316 (3, 1, 6)
+#define REPEAT_N_317 (3, 1, 7)
+#define REPEAT_N_318 (3, 1, 8)
+#define REPEAT_N_319 (3, 1, 9)
+#define REPEAT_N_320 (3, 2, 0)
+#define REPEAT_N_321 (3, 2, 1)
+#define REPEAT_N_322 (3, 2, 2)
+#define REPEAT_N_323 (3, 2, 3)
+#define REPEAT_N_324 (3, 2, 4)
+#define REPEAT_N_325 (3, 2, 5)
+#define REPEAT_N_326 (3, 2, 6)
+#define REPEAT_N_327 (3, 2, 7)
+#define REPEAT_N_328 (3, 2, 8)
+#define REPEAT_N_329 (3, 2, 9)
+#define REPEAT_N_330 (3, 3, 0)
+#define REPEAT_N_331 (3, 3, 1)
+#define REPEAT_N_332 (3, 3, 2)
+#define REPEAT_N_333 (3, 3, 3)
+#define REPEAT_N_334 (3, 3, 4)
+#define REPEAT_N_335 (3, 3, 5)
+#define REPEAT_N_336 (3, 3, 6)
+#define REPEAT_N_337 (3, 3, 7)
+#define REPEAT_N_338 (3, 3, 8)
+#define REPEAT_N_339 (3, 3, 9)
+#define REPEAT_N_340 (3, 4, 0)
+#define REPEAT_N_341 (3, 4, 1)
+#define REPEAT_N_342 (3, 4, 2)
+#define REPEAT_N_343 (3, 4, 3)
+#define REPEAT_N_344 (3, 4, 4)
+#define REPEAT_N_345 (3, 4, 5)
+#define REPEAT_N_346 (3, 4, 6)
+#define REPEAT_N_347 (3, 4, 7)
+#define REPEAT_N_348 (3, 4, 8)
+#define REPEAT_N_349 (3, 4, 9)
+#define REPEAT_N_350 (3, 5, 0)
+#define REPEAT_N_351 (3, 5, 1)
+#define REPEAT_N_352 (3, 5, 2)
+#define REPEAT_N_353 (3, 5, 3)
+#define REPEAT_N_354 (3, 5, 4)
+#define REPEAT_N_355 (3, 5, 5)
+#define REPEAT_N_356 (3, 5, 6)
+#define REPEAT_N_357 (3, 5, 7)
+#define REPEAT_N_358 (3, 5, 8)
+#define REPEAT_N_359 (3, 5, 9)
+#define REPEAT_N_360 (3, 6, 0)
+#define REPEAT_N_361 (3, 6, 1)
+#define REPEAT_N_362 (3, 6, 2)
+#define REPEAT_N_363 (3, 6, 3)
+#define REPEAT_N_364 (3, 6, 4)
+#define REPEAT_N_365 (3, 6, 5)
+#define REPEAT_N_366 (3, 6, 6)
+#define REPEAT_N_367 (3, 6, 7)
+#define REPEAT_N_368 (3, 6, 8)
+#define REPEAT_N_369 (3, 6, 9)
+#define REPEAT_N_370 (3, 7, 0)
+#define REPEAT_N_371 (3, 7, 1)
+#define REPEAT_N_372 (3, 7, 2)
+#define REPEAT_N_373 (3, 7, 3)
+#define REPEAT_N_374 (3, 7, 4)
+#define REPEAT_N_375 (3, 7, 5)
+#define REPEAT_N_376 (3, 7, 6)
+#define REPEAT_N_377 (3, 7, 7)
+#define REPEAT_N_378 (3, 7, 8)
+#define REPEAT_N_379 (3, 7, 9)
+#define REPEAT_N_380 (3, 8, 0)
+#define REPEAT_N_381 (3, 8, 1)
+#define REPEAT_N_382 (3, 8, 2)
+#define REPEAT_N_383 (3, 8, 3)
+#define REPEAT_N_384 (3, 8, 4)
+#define REPEAT_N_385 (3, 8, 5)
+#define REPEAT_N_386 (3, 8, 6)
+#define REPEAT_N_387 (3, 8, 7)
+#define REPEAT_N_388 (3, 8, 8)
+#define REPEAT_N_389 (3, 8, 9)
+#define REPEAT_N_390 (3, 9, 0)
+#define REPEAT_N_391 (3, 9, 1)
+#define REPEAT_N_392 (3, 9, 2)
+#define REPEAT_N_393 (3, 9, 3)
+#define REPEAT_N_394 (3, 9, 4)
+#define REPEAT_N_395 (3, 9, 5)
+#define REPEAT_N_396 (3, 9, 6)
+#define REPEAT_N_397 (3, 9, 7)
+#define REPEAT_N_398 (3, 9, 8)
+#define REPEAT_N_399 (3, 9, 9)
+#define REPEAT_N_400 (4, 0, 0)
+#define REPEAT_N_401 (4, 0, 1)
+#define REPEAT_N_402 (4, 0, 2)
+#define REPEAT_N_403 (4, 0, 3)
+#define REPEAT_N_404 (4, 0, 4)
+#define REPEAT_N_405 (4, 0, 5)
+#define REPEAT_N_406 (4, 0, 6)
+#define REPEAT_N_407 (4, 0, 7)
+#define REPEAT_N_408 (4, 0, 8)
+#define REPEAT_N_409 (4, 0, 9)
+#define REPEAT_N_410 (4, 1, 0)
+#define REPEAT_N_411 (4, 1, 1)
+#define REPEAT_N_412 (4, 1, 2)
+#define REPEAT_N_413 (4, 1, 3)
+#define REPEAT_N_414 (4, 1, 4)
+#define REPEAT_N_415 (4, 1, 5)
+#define REPEAT_N_416 (4, 1, 6)
+#define REPEAT_N_417 (4, 1, 7)
+#define REPEAT_N_418 (4, 1, 8)
+#define REPEAT_N_419 (4, 1, 9)
+#define REPEAT_N_420 (4, 2, 0)
+#define REPEAT_N_421 (4, 2, 1)
+#define REPEAT_N_422 (4, 2, 2)
+#define REPEAT_N_423 (4, 2, 3)
+#define REPEAT_N_424 (4, 2, 4)
+#define REPEAT_N_425 (4, 2, 5)
+#define REPEAT_N_426 (4, 2, 6)
+#define REPEAT_N_427 (4, 2, 7)
+#define REPEAT_N_428 (4, 2, 8)
+#define REPEAT_N_429 (4, 2, 9)
+#define REPEAT_N_430 (4, 3, 0)
+#define REPEAT_N_431 (4, 3, 1)
+#define REPEAT_N_432 (4, 3, 2)
+#define REPEAT_N_433 (4, 3, 3)
+#define REPEAT_N_434 (4, 3, 4)
+#define REPEAT_N_435 (4, 3, 5)
+#define REPEAT_N_436 (4, 3, 6)
+#define REPEAT_N_437 (4, 3, 7)
+#define REPEAT_N_438 (4, 3, 8)
+#define REPEAT_N_439 (4, 3, 9)
+#define REPEAT_N_440 (4, 4, 0)
+#define REPEAT_N_441 (4, 4, 1)
+#define REPEAT_N_442 (4, 4, 2)
+#define REPEAT_N_443 (4, 4, 3)
+#define REPEAT_N_444 (4, 4, 4)
+#define REPEAT_N_445 (4, 4, 5)
+#define REPEAT_N_446 (4, 4, 6)
+#define REPEAT_N_447 (4, 4, 7)
+#define REPEAT_N_448 (4, 4, 8)
+#define REPEAT_N_449 (4, 4, 9)
+#define REPEAT_N_450 (4, 5, 0)
+#define REPEAT_N_451 (4, 5, 1)
+#define REPEAT_N_452 (4, 5, 2)
+#define REPEAT_N_453 (4, 5, 3)
+#define REPEAT_N_454 (4, 5, 4)
+#define REPEAT_N_455 (4, 5, 5)
+#define REPEAT_N_456 (4, 5, 6)
+#define REPEAT_N_457 (4, 5, 7)
+#define REPEAT_N_458 (4, 5, 8)
+#define REPEAT_N_459 (4, 5, 9)
+#define REPEAT_N_460 (4, 6, 0)
+#define REPEAT_N_461 (4, 6, 1)
+#define REPEAT_N_462 (4, 6, 2)
+#define REPEAT_N_463 (4, 6, 3)
+#define REPEAT_N_464 (4, 6, 4)
+#define REPEAT_N_465 (4, 6, 5)
+#define REPEAT_N_466 (4, 6, 6)
+#define REPEAT_N_467 (4, 6, 7)
+#define REPEAT_N_468 (4, 6, 8)
+#define REPEAT_N_469 (4, 6, 9)
+#define REPEAT_N_470 (4, 7, 0)
+#define REPEAT_N_471 (4, 7, 1)
+#define REPEAT_N_472 (4, 7, 2)
+#define REPEAT_N_473 (4, 7, 3)
+#define REPEAT_N_474 (4, 7, 4)
+#define REPEAT_N_475 (4, 7, 5)
+#define REPEAT_N_476 (4, 7, 6)
+#define REPEAT_N_477 (4, 7, 7)
+#define REPEAT_N_478 (4, 7, 8)
+#define REPEAT_N_479 (4, 7, 9)
+#define REPEAT_N_480 (4, 8, 0)
+#define REPEAT_N_481 (4, 8, 1)
+#define REPEAT_N_482 (4, 8, 2)
+#define REPEAT_N_483 (4, 8, 3)
+#define REPEAT_N_484 (4, 8, 4)
+#define REPEAT_N_485 (4, 8, 5)
+#define REPEAT_N_486 (4, 8, 6)
+#define REPEAT_N_487 (4, 8, 7)
+#define REPEAT_N_488 (4, 8, 8)
+#define REPEAT_N_489 (4, 8, 9)
+#define REPEAT_N_490 (4, 9, 0)
+#define REPEAT_N_491 (4, 9, 1)
+#define REPEAT_N_492 (4, 9, 2)
+#define REPEAT_N_493 (4, 9, 3)
+#define REPEAT_N_494 (4, 9, 4)
+#define REPEAT_N_495 (4, 9, 5)
+#define REPEAT_N_496 (4, 9, 6)
+#define REPEAT_N_497 (4, 9, 7)
+#define REPEAT_N_498 (4, 9, 8)
+#define REPEAT_N_499 (4, 9, 9)
+#define REPEAT_N_500 (5, 0, 0)
+#define REPEAT_N_501 (5, 0, 1)
+#define REPEAT_N_502 (5, 0, 2)
+#define REPEAT_N_503 (5, 0, 3)
+#define REPEAT_N_504 (5, 0, 4)
+#define REPEAT_N_505 (5, 0, 5)
+#define REPEAT_N_506 (5, 0, 6)
+#define REPEAT_N_507 (5, 0, 7)
+#define REPEAT_N_508 (5, 0, 8)
+#define REPEAT_N_509 (5, 0, 9)
+#define REPEAT_N_510 (5, 1, 0)
+#define REPEAT_N_511 (5, 1, 1)
+#define REPEAT_N_512 (5, 1, 2)
+#define REPEAT_N_513 (5, 1, 3)
+#define REPEAT_N_514 (5, 1, 4)
+#define REPEAT_N_515 (5, 1, 5)
+#define REPEAT_N_516 (5, 1, 6)
+#define REPEAT_N_517 (5, 1, 7)
+#define REPEAT_N_518 (5, 1, 8)
+#define REPEAT_N_519 (5, 1, 9)
+#define REPEAT_N_520 (5, 2, 0)
+#define REPEAT_N_521 (5, 2, 1)
+#define REPEAT_N_522 (5, 2, 2)
+#define REPEAT_N_523 (5, 2, 3)
+#define REPEAT_N_524 (5, 2, 4)
+#define REPEAT_N_525 (5, 2, 5)
+#define REPEAT_N_526 (5, 2, 6)
+#define REPEAT_N_527 (5, 2, 7)
+#define REPEAT_N_528 (5, 2, 8)
+#define REPEAT_N_529 (5, 2, 9)
+#define REPEAT_N_530 (5, 3, 0)
+#define REPEAT_N_531 (5, 3, 1)
+#define REPEAT_N_532 (5, 3, 2)
+#define REPEAT_N_533 (5, 3, 3)
+#define REPEAT_N_534 (5, 3, 4)
+#define REPEAT_N_535 (5, 3, 5)
+#define REPEAT_N_536 (5, 3, 6)
+#define REPEAT_N_537 (5, 3, 7)
+#define REPEAT_N_538 (5, 3, 8)
+#define REPEAT_N_539 (5, 3, 9)
+#define REPEAT_N_540 (5, 4, 0)
+#define REPEAT_N_541 (5, 4, 1)
+#define REPEAT_N_542 (5, 4, 2)
+#define REPEAT_N_543 (5, 4, 3)
+#define REPEAT_N_544 (5, 4, 4)
+#define REPEAT_N_545 (5, 4, 5)
+#define REPEAT_N_546 (5, 4, 6)
+#define REPEAT_N_547 (5, 4, 7)
+#define REPEAT_N_548 (5, 4, 8)
+#define REPEAT_N_549 (5, 4, 9)
+#define REPEAT_N_550 (5, 5, 0)
+#define REPEAT_N_551 (5, 5, 1)
+#define REPEAT_N_552 (5, 5, 2)
+#define REPEAT_N_553 (5, 5, 3)
+#define REPEAT_N_554 (5, 5, 4)
+#define REPEAT_N_555 (5, 5, 5)
+#define REPEAT_N_556 (5, 5, 6)
+#define REPEAT_N_557 (5, 5, 7)
+#define REPEAT_N_558 (5, 5, 8)
+#define REPEAT_N_559 (5, 5, 9)
+#define REPEAT_N_560 (5, 6, 0)
+#define REPEAT_N_561 (5, 6, 1)
+#define REPEAT_N_562 (5, 6, 2)
+#define REPEAT_N_563 (5, 6, 3)
+#define REPEAT_N_564 (5, 6, 4)
+#define REPEAT_N_565 (5, 6, 5)
+#define REPEAT_N_566 (5, 6, 6)
+#define REPEAT_N_567 (5, 6, 7)
+#define REPEAT_N_568 (5, 6, 8)
+#define REPEAT_N_569 (5, 6, 9)
+#define REPEAT_N_570 (5, 7, 0)
+#define REPEAT_N_571 (5, 7, 1)
+#define REPEAT_N_572 (5, 7, 2)
+#define REPEAT_N_573 (5, 7, 3)
+#define REPEAT_N_574 (5, 7, 4)
+#define REPEAT_N_575 (5, 7, 5)
+#define REPEAT_N_576 (5, 7, 6)
+#define REPEAT_N_577 (5, 7, 7)
+#define REPEAT_N_578 (5, 7, 8)
+#define REPEAT_N_579 (5, 7, 9)
+#define REPEAT_N_580 (5, 8, 0)
+#define REPEAT_N_581 (5, 8, 1)
+#define REPEAT_N_582 (5, 8, 2)
+#define REPEAT_N_583 (5, 8, 3)
+#define REPEAT_N_584 (5, 8, 4)
+#define REPEAT_N_585 (5, 8, 5)
+#define REPEAT_N_586 (5, 8, 6)
+#define REPEAT_N_587 (5, 8, 7)
+#define REPEAT_N_588 (5, 8, 8)
+#define REPEAT_N_589 (5, 8, 9)
+#define REPEAT_N_590 (5, 9, 0)
+#define REPEAT_N_591 (5, 9, 1)
+#define REPEAT_N_592 (5, 9, 2)
+#define REPEAT_N_593 (5, 9, 3)
+#define REPEAT_N_594 (5, 9, 4)
+#define REPEAT_N_595 (5, 9, 5)
+#define REPEAT_N_596 (5, 9, 6)
+#define REPEAT_N_597 (5, 9, 7)
+#define REPEAT_N_598 (5, 9, 8)
+#define REPEAT_N_599 (5, 9, 9)
+#define REPEAT_N_600 (6, 0, 0)
+#define REPEAT_N_601 (6, 0, 1)
+#define REPEAT_N_602 (6, 0, 2)
+#define REPEAT_N_603 (6, 0, 3)
+#define REPEAT_N_604 (6, 0, 4)
+#define REPEAT_N_605 (6, 0, 5)
+#define REPEAT_N_606 (6, 0, 6)
+#define REPEAT_N_607 (6, 0, 7)
+#define REPEAT_N_608 (6, 0, 8)
+#define REPEAT_N_609 (6, 0, 9)
+#define REPEAT_N_610 (6, 1, 0)
+#define REPEAT_N_611 (6, 1, 1)
+#define REPEAT_N_612 (6, 1, 2)
+#define REPEAT_N_613 (6, 1, 3)
+#define REPEAT_N_614 (6, 1, 4)
+#define REPEAT_N_615 (6, 1, 5)
+#define REPEAT_N_616 (6, 1, 6)
+#define REPEAT_N_617 (6, 1, 7)
+#define REPEAT_N_618 (6, 1, 8)
+#define REPEAT_N_619 (6, 1, 9)
+#define REPEAT_N_620 (6, 2, 0)
+#define REPEAT_N_621 (6, 2, 1)
+#define REPEAT_N_622 (6, 2, 2)
+#define REPEAT_N_623 (6, 2, 3)
+#define REPEAT_N_624 (6, 2, 4)
+#define REPEAT_N_625 (6, 2, 5)
+#define REPEAT_N_626 (6, 2, 6)
+#define REPEAT_N_627 (6, 2, 7)
+#define REPEAT_N_628 (6, 2, 8)
+#define REPEAT_N_629 (6, 2, 9)
+#define REPEAT_N_630 (6, 3, 0)
+#define REPEAT_N_631 (6, 3, 1)
+#define REPEAT_N_632 (6, 3, 2)
+#define REPEAT_N_633 (6, 3, 3)
+#define REPEAT_N_634 (6, 3, 4)
+#define REPEAT_N_635 (6, 3, 5)
+#define REPEAT_N_636 (6, 3, 6)
+#define REPEAT_N_637 (6, 3, 7)
+#define REPEAT_N_638 (6, 3, 8)
+#define REPEAT_N_639 (6, 3, 9)
+#define REPEAT_N_640 (6, 4, 0)
+#define REPEAT_N_641 (6, 4, 1)
+#define REPEAT_N_642 (6, 4, 2)
+#define REPEAT_N_643 (6, 4, 3)
+#define REPEAT_N_644 (6, 4, 4)
+#define REPEAT_N_645 (6, 4, 5)
+#define REPEAT_N_646 (6, 4, 6)
+#define REPEAT_N_647 (6, 4, 7)
+#define REPEAT_N_648 (6, 4, 8)
+#define REPEAT_N_649 (6, 4, 9)
+#define REPEAT_N_650 (6, 5, 0)
+#define REPEAT_N_651 (6, 5, 1)
+#define REPEAT_N_652 (6, 5, 2)
+#define REPEAT_N_653 (6, 5, 3)
+#define REPEAT_N_654 (6, 5, 4)
+#define REPEAT_N_655 (6, 5, 5)
+#define REPEAT_N_656 (6, 5, 6)
+#define REPEAT_N_657 (6, 5, 7)
+#define REPEAT_N_658 (6, 5, 8)
+#define REPEAT_N_659 (6, 5, 9)
+#define REPEAT_N_660 (6, 6, 0)
+#define REPEAT_N_661 (6, 6, 1)
+#define REPEAT_N_662 (6, 6, 2)
+#define REPEAT_N_663 (6, 6, 3)
+#define REPEAT_N_664 (6, 6, 4)
+#define REPEAT_N_665 (6, 6, 5)
+#define REPEAT_N_666 (6, 6, 6)
+#define REPEAT_N_667 (6, 6, 7)
+#define REPEAT_N_668 (6, 6, 8)
+#define REPEAT_N_669 (6, 6, 9)
+#define REPEAT_N_670 (6, 7, 0)
+#define REPEAT_N_671 (6, 7, 1)
+#define REPEAT_N_672 (6, 7, 2)
+#define REPEAT_N_673 (6, 7, 3)
+#define REPEAT_N_674 (6, 7, 4)
+#define REPEAT_N_675 (6, 7, 5)
+#define REPEAT_N_676 (6, 7, 6)
+#define REPEAT_N_677 (6, 7, 7)
+#define REPEAT_N_678 (6, 7, 8)
+#define REPEAT_N_679 (6, 7, 9)
+#define REPEAT_N_680 (6, 8, 0)
+#define REPEAT_N_681 (6, 8, 1)
+#define REPEAT_N_682 (6, 8, 2)
+#define REPEAT_N_683 (6, 8, 3)
+#define REPEAT_N_684 (6, 8, 4)
+#define REPEAT_N_685 (6, 8, 5)
+#define REPEAT_N_686 (6, 8, 6)
+#define REPEAT_N_687 (6, 8, 7)
+#define REPEAT_N_688 (6, 8, 8)
+#define REPEAT_N_689 (6, 8, 9)
+#define REPEAT_N_690 (6, 9, 0)
+#define REPEAT_N_691 (6, 9, 1)
+#define REPEAT_N_692 (6, 9, 2)
+#define REPEAT_N_693 (6, 9, 3)
+#define REPEAT_N_694 (6, 9, 4)
+#define REPEAT_N_695 (6, 9, 5)
+#define REPEAT_N_696 (6, 9, 6)
+#define REPEAT_N_697 (6, 9, 7)
+#define REPEAT_N_698 (6, 9, 8)
+#define REPEAT_N_699 (6, 9, 9)
+#define REPEAT_N_700 (7, 0, 0)
+#define REPEAT_N_701 (7, 0, 1)
+#define REPEAT_N_702 (7, 0, 2)
+#define REPEAT_N_703 (7, 0, 3)
+#define REPEAT_N_704 (7, 0, 4)
+#define REPEAT_N_705 (7, 0, 5)
+#define REPEAT_N_706 (7, 0, 6)
+#define REPEAT_N_707 (7, 0, 7)
+#define REPEAT_N_708 (7, 0, 8)
+#define REPEAT_N_709 (7, 0, 9)
+#define REPEAT_N_710 (7, 1, 0)
+#define REPEAT_N_711 (7, 1, 1)
+#define REPEAT_N_712 (7, 1, 2)
+#define REPEAT_N_713 (7, 1, 3)
+#define REPEAT_N_714 (7, 1, 4)
+#define REPEAT_N_715 (7, 1, 5)
+#define REPEAT_N_716 (7, 1, 6)
+#define REPEAT_N_717 (7, 1, 7)
+#define REPEAT_N_718 (7, 1, 8)
+#define REPEAT_N_719 (7, 1, 9)
+#define REPEAT_N_720 (7, 2, 0)
+#define REPEAT_N_721 (7, 2, 1)
+#define REPEAT_N_722 (7, 2, 2)
+#define REPEAT_N_723 (7, 2, 3)
+#define REPEAT_N_724 (7, 2, 4)
+#define REPEAT_N_725 (7, 2, 5)
+#define REPEAT_N_726 (7, 2, 6)
+#define REPEAT_N_727 (7, 2, 7)
+#define REPEAT_N_728 (7, 2, 8)
+#define REPEAT_N_729 (7, 2, 9)
+#define REPEAT_N_730 (7, 3, 0)
+#define REPEAT_N_731 (7, 3, 1)
+#define REPEAT_N_732 (7, 3, 2)
+#define REPEAT_N_733 (7, 3, 3)
+#define REPEAT_N_734 (7, 3, 4)
+#define REPEAT_N_735 (7, 3, 5)
+#define REPEAT_N_736 (7, 3, 6)
+#define REPEAT_N_737 (7, 3, 7)
+#define REPEAT_N_738 (7, 3, 8)
+#define REPEAT_N_739 (7, 3, 9)
+#define REPEAT_N_740 (7, 4, 0)
+#define REPEAT_N_741 (7, 4, 1)
+#define REPEAT_N_742 (7, 4, 2)
+#define REPEAT_N_743 (7, 4, 3)
+#define REPEAT_N_744 (7, 4, 4)
+#define REPEAT_N_745 (7, 4, 5)
+#define REPEAT_N_746 (7, 4, 6)
+#define REPEAT_N_747 (7, 4, 7)
+#define REPEAT_N_748 (7, 4, 8)
+#define REPEAT_N_749 (7, 4, 9)
+#define REPEAT_N_750 (7, 5, 0)
+#define REPEAT_N_751 (7, 5, 1)
+#define REPEAT_N_752 (7, 5, 2)
+#define REPEAT_N_753 (7, 5, 3)
+#define REPEAT_N_754 (7, 5, 4)
+#define REPEAT_N_755 (7, 5, 5)
+#define REPEAT_N_756 (7, 5, 6)
+#define REPEAT_N_757 (7, 5, 7)
+#define REPEAT_N_758 (7, 5, 8)
+#define REPEAT_N_759 (7, 5, 9)
+#define REPEAT_N_760 (7, 6, 0)
+#define REPEAT_N_761 (7, 6, 1)
+#define REPEAT_N_762 (7, 6, 2)
+#define REPEAT_N_763 (7, 6, 3)
+#define REPEAT_N_764 (7, 6, 4)
+#define REPEAT_N_765 (7, 6, 5)
+#define REPEAT_N_766 (7, 6, 6)
+#define REPEAT_N_767 (7, 6, 7)
+#define REPEAT_N_768 (7, 6, 8)
+#define REPEAT_N_769 (7, 6, 9)
+#define REPEAT_N_770 (7, 7, 0)
+#define REPEAT_N_771 (7, 7, 1)
+#define REPEAT_N_772 (7, 7, 2)
+#define REPEAT_N_773 (7, 7, 3)
+#define REPEAT_N_774 (7, 7, 4)
+#define REPEAT_N_775 (7, 7, 5)
+#define REPEAT_N_776 (7, 7, 6)
+#define REPEAT_N_777 (7, 7, 7)
+#define REPEAT_N_778 (7, 7, 8)
+#define REPEAT_N_779 (7, 7, 9)
+#define REPEAT_N_780 (7, 8, 0)
+#define REPEAT_N_781 (7, 8, 1)
+#define REPEAT_N_782 (7, 8, 2)
+#define REPEAT_N_783 (7, 8, 3)
+#define REPEAT_N_784 (7, 8, 4)
+#define REPEAT_N_785 (7, 8, 5)
+#define REPEAT_N_786 (7, 8, 6)
+#define REPEAT_N_787 (7, 8, 7)
+#define REPEAT_N_788 (7, 8, 8)
+#define REPEAT_N_789 (7, 8, 9)
+#define REPEAT_N_790 (7, 9, 0)
+#define REPEAT_N_791 (7, 9, 1)
+#define REPEAT_N_792 (7, 9, 2)
+#define REPEAT_N_793 (7, 9, 3)
+#define REPEAT_N_794 (7, 9, 4)
+#define REPEAT_N_795 (7, 9, 5)
+#define REPEAT_N_796 (7, 9, 6)
+#define REPEAT_N_797 (7, 9, 7)
+#define REPEAT_N_798 (7, 9, 8)
+#define REPEAT_N_799 (7, 9, 9)
+#define REPEAT_N_800 (8, 0, 0)
+#define REPEAT_N_801 (8, 0, 1)
+#define REPEAT_N_802 (8, 0, 2)
+#define REPEAT_N_803 (8, 0, 3)
+#define REPEAT_N_804 (8, 0, 4)
+#define REPEAT_N_805 (8, 0, 5)
+#define REPEAT_N_806 (8, 0, 6)
+#define REPEAT_N_807 (8, 0, 7)
+#define REPEAT_N_808 (8, 0, 8)
+#define REPEAT_N_809 (8, 0, 9)
+#define REPEAT_N_810 (8, 1, 0)
+#define REPEAT_N_811 (8, 1, 1)
+#define REPEAT_N_812 (8, 1, 2)
+#define REPEAT_N_813 (8, 1, 3)
+#define REPEAT_N_814 (8, 1, 4)
+#define REPEAT_N_815 (8, 1, 5)
+#define REPEAT_N_816 (8, 1, 6)
+#define REPEAT_N_817 (8, 1, 7)
+#define REPEAT_N_818 (8, 1, 8)
+#define REPEAT_N_819 (8, 1, 9)
+#define REPEAT_N_820 (8, 2, 0)
+#define REPEAT_N_821 (8, 2, 1)
+#define REPEAT_N_822 (8, 2, 2)
+#define REPEAT_N_823 (8, 2, 3)
+#define REPEAT_N_824 (8, 2, 4)
+#define REPEAT_N_825 (8, 2, 5)
+#define REPEAT_N_826 (8, 2, 6)
+#define REPEAT_N_827 (8, 2, 7)
+#define REPEAT_N_828 (8, 2, 8)
+#define REPEAT_N_829 (8, 2, 9)
+#define REPEAT_N_830 (8, 3, 0)
+#define REPEAT_N_831 (8, 3, 1)
+#define REPEAT_N_832 (8, 3, 2)
+#define REPEAT_N_833 (8, 3, 3)
+#define REPEAT_N_834 (8, 3, 4)
+#define REPEAT_N_835 (8, 3, 5)
+#define REPEAT_N_836 (8, 3, 6)
+#define REPEAT_N_837 (8, 3, 7)
+#define REPEAT_N_838 (8, 3, 8)
+#define REPEAT_N_839 (8, 3, 9)
+#define REPEAT_N_840 (8, 4, 0)
+#define REPEAT_N_841 (8, 4, 1)
+#define REPEAT_N_842 (8, 4, 2)
+#define REPEAT_N_843 (8, 4, 3)
+#define REPEAT_N_844 (8, 4, 4)
+#define REPEAT_N_845 (8, 4, 5)
+#define REPEAT_N_846 (8, 4, 6)
+#define REPEAT_N_847 (8, 4, 7)
+#define REPEAT_N_848 (8, 4, 8)
+#define REPEAT_N_849 (8, 4, 9)
+#define REPEAT_N_850 (8, 5, 0)
+#define REPEAT_N_851 (8, 5, 1)
+#define REPEAT_N_852 (8, 5, 2)
+#define REPEAT_N_853 (8, 5, 3)
+#define REPEAT_N_854 (8, 5, 4)
+#define REPEAT_N_855 (8, 5, 5)
+#define REPEAT_N_856 (8, 5, 6)
+#define REPEAT_N_857 (8, 5, 7)
+#define REPEAT_N_858 (8, 5, 8)
+#define REPEAT_N_859 (8, 5, 9)
+#define REPEAT_N_860 (8, 6, 0)
+#define REPEAT_N_861 (8, 6, 1)
+#define REPEAT_N_862 (8, 6, 2)
+#define REPEAT_N_863 (8, 6, 3)
+#define REPEAT_N_864 (8, 6, 4)
+#define REPEAT_N_865 (8, 6, 5)
+#define REPEAT_N_866 (8, 6, 6)
+#define REPEAT_N_867 (8, 6, 7)
+#define REPEAT_N_868 (8, 6, 8)
+#define REPEAT_N_869 (8, 6, 9)
+#define REPEAT_N_870 (8, 7, 0)
+#define REPEAT_N_871 (8, 7, 1)
+#define REPEAT_N_872 (8, 7, 2)
+#define REPEAT_N_873 (8, 7, 3)
+#define REPEAT_N_874 (8, 7, 4)
+#define REPEAT_N_875 (8, 7, 5)
+#define REPEAT_N_876 (8, 7, 6)
+#define REPEAT_N_877 (8, 7, 7)
+#define REPEAT_N_878 (8, 7, 8)
+#define REPEAT_N_879 (8, 7, 9)
+#define REPEAT_N_880 (8, 8, 0)
+#define REPEAT_N_881 (8, 8, 1)
+#define REPEAT_N_882 (8, 8, 2)
+#define REPEAT_N_883 (8, 8, 3)
+#define REPEAT_N_884 (8, 8, 4)
+#define REPEAT_N_885 (8, 8, 5)
+#define REPEAT_N_886 (8, 8, 6)
+#define REPEAT_N_887 (8, 8, 7)
+#define REPEAT_N_888 (8, 8, 8)
+#define REPEAT_N_889 (8, 8, 9)
+#define REPEAT_N_890 (8, 9, 0)
+#define REPEAT_N_891 (8, 9, 1)
+#define REPEAT_N_892 (8, 9, 2)
+#define REPEAT_N_893 (8, 9, 3)
+#define REPEAT_N_894 (8, 9, 4)
+#define REPEAT_N_895 (8, 9, 5)
+#define REPEAT_N_896 (8, 9, 6)
+#define REPEAT_N_897 (8, 9, 7)
+#define REPEAT_N_898 (8, 9, 8)
+#define REPEAT_N_899 (8, 9, 9)
+#define REPEAT_N_900 (9, 0, 0)
+#define REPEAT_N_901 (9, 0, 1)
+#define REPEAT_N_902 (9, 0, 2)
+#define REPEAT_N_903 (9, 0, 3)
+#define REPEAT_N_904 (9, 0, 4)
+#define REPEAT_N_905 (9, 0, 5)
+#define REPEAT_N_906 (9, 0, 6)
+#define REPEAT_N_907 (9, 0, 7)
+#define REPEAT_N_908 (9, 0, 8)
+#define REPEAT_N_909 (9, 0, 9)
+#define REPEAT_N_910 (9, 1, 0)
+#define REPEAT_N_911 (9, 1, 1)
+#define REPEAT_N_912 (9, 1, 2)
+#define REPEAT_N_913 (9, 1, 3)
+#define REPEAT_N_914 (9, 1, 4)
+#define REPEAT_N_915 (9, 1, 5)
+#define REPEAT_N_916 (9, 1, 6)
+#define REPEAT_N_917 (9, 1, 7)
+#define REPEAT_N_918 (9, 1, 8)
+#define REPEAT_N_919 (9, 1, 9)
+#define REPEAT_N_920 (9, 2, 0)
+#define REPEAT_N_921 (9, 2, 1)
+#define REPEAT_N_922 (9, 2, 2)
+#define REPEAT_N_923 (9, 2, 3)
+#define REPEAT_N_924 (9, 2, 4)
+#define REPEAT_N_925 (9, 2, 5)
+#define REPEAT_N_926 (9, 2, 6)
+#define REPEAT_N_927 (9, 2, 7)
+#define REPEAT_N_928 (9, 2, 8)
+#define REPEAT_N_929 (9, 2, 9)
+#define REPEAT_N_930 (9, 3, 0)
+#define REPEAT_N_931 (9, 3, 1)
+#define REPEAT_N_932 (9, 3, 2)
+#define REPEAT_N_933 (9, 3, 3)
+#define REPEAT_N_934 (9, 3, 4)
+#define REPEAT_N_935 (9, 3, 5)
+#define REPEAT_N_936 (9, 3, 6)
+#define REPEAT_N_937 (9, 3, 7)
+#define REPEAT_N_938 (9, 3, 8)
+#define REPEAT_N_939 (9, 3, 9)
+#define REPEAT_N_940 (9, 4, 0)
+#define REPEAT_N_941 (9, 4, 1)
+#define REPEAT_N_942 (9, 4, 2)
+#define REPEAT_N_943 (9, 4, 3)
+#define REPEAT_N_944 (9, 4, 4)
+#define REPEAT_N_945 (9, 4, 5)
+#define REPEAT_N_946 (9, 4, 6)
+#define REPEAT_N_947 (9, 4, 7)
+#define REPEAT_N_948 (9, 4, 8)
+#define REPEAT_N_949 (9, 4, 9)
+#define REPEAT_N_950 (9, 5, 0)
+#define REPEAT_N_951 (9, 5, 1)
+#define REPEAT_N_952 (9, 5, 2)
+#define REPEAT_N_953 (9, 5, 3)
+#define REPEAT_N_954 (9, 5, 4)
+#define REPEAT_N_955 (9, 5, 5)
+#define REPEAT_N_956 (9, 5, 6)
+#define REPEAT_N_957 (9, 5, 7)
+#define REPEAT_N_958 (9, 5, 8)
+#define REPEAT_N_959 (9, 5, 9)
+#define REPEAT_N_960 (9, 6, 0)
+#define REPEAT_N_961 (9, 6, 1)
+#define REPEAT_N_962 (9, 6, 2)
+#define REPEAT_N_963 (9, 6, 3)
+#define REPEAT_N_964 (9, 6, 4)
+#define REPEAT_N_965 (9, 6, 5)
+#define REPEAT_N_966 (9, 6, 6)
+#define REPEAT_N_967 (9, 6, 7)
+#define REPEAT_N_968 (9, 6, 8)
+#define REPEAT_N_969 (9, 6, 9)
+#define REPEAT_N_970 (9, 7, 0)
+#define REPEAT_N_971 (9, 7, 1)
+#define REPEAT_N_972 (9, 7, 2)
+#define REPEAT_N_973 (9, 7, 3)
+#define REPEAT_N_974 (9, 7, 4)
+#define REPEAT_N_975 (9, 7, 5)
+#define REPEAT_N_976 (9, 7, 6)
+#define REPEAT_N_977 (9, 7, 7)
+#define REPEAT_N_978 (9, 7, 8)
+#define REPEAT_N_979 (9, 7, 9)
+#define REPEAT_N_980 (9, 8, 0)
+#define REPEAT_N_981 (9, 8, 1)
+#define REPEAT_N_982 (9, 8, 2)
+#define REPEAT_N_983 (9, 8, 3)
+#define REPEAT_N_984 (9, 8, 4)
+#define REPEAT_N_985 (9, 8, 5)
+#define REPEAT_N_986 (9, 8, 6)
+#define REPEAT_N_987 (9, 8, 7)
+#define REPEAT_N_988 (9, 8, 8)
+#define REPEAT_N_989 (9, 8, 9)
+#define REPEAT_N_990 (9, 9, 0)
+#define REPEAT_N_991 (9, 9, 1)
+#define REPEAT_N_992 (9, 9, 2)
+#define REPEAT_N_993 (9, 9, 3)
+#define REPEAT_N_994 (9, 9, 4)
+#define REPEAT_N_995 (9, 9, 5)
+#define REPEAT_N_996 (9, 9, 6)
+#define REPEAT_N_997 (9, 9, 7)
+#define REPEAT_N_998 (9, 9, 8)
+#define REPEAT_N_999 (9, 9, 9)
+/* clang-format on */
@@ -14,7 +14,8 @@
  * CM(REMOVE_COMMAS, CM_NO_STATE, 1, 2, 3, 4, 5) // expands to 1 2 3 4 5
  * @endcode
  *
- * @note Number of iterations shall be finite (currently not more than 2046).
+ * @note Number of iterations shall be finite (not more than 2046 by default,
+ * see `CM_MAX_LEVEL` and `Ladder selection`).
  *
  * Arguments:
  * - `f`: **Transition function** - a map of the form `(prefix, current_f,
@@ -46,6 +47,28 @@
  * expands to `state` (without encapsulating parentheses).
  * - `CM_ABORT_ITER(x)`: Iteration limit reached. Preprocessing fails.
  *
+ * @section cm_emit Streaming output
+ * Output accumulated in `state` is copied on every iteration. Instead, `f` may
+ * return `CM_EMIT(tokens, p, f, state, ...)`, which is the same machine state,
+ * followed by `tokens` (without encapsulating parentheses). Iteration goes on
+ * as usual, and `tokens` are left in the expansion, right after the result of
+ * `CM_RETURN`. Example:
+ *
+ * @code
+ * #define CM_DECLARE(p, f, state, name, ...)                               \
+ *   CM_EMIT((int name;), , IF(IS_EMPTY(__VA_ARGS__))(EXIT, f), state,     \
+ *           __VA_ARGS__)
+ *
+ * CM(DECLARE, CM_NO_STATE, a, b, c) // expands to int c; int b; int a;
+ * @endcode
+ *
+ * @note Tokens are placed in front of ones emitted at previous iterations, so
+ * they come out in reverse order. To keep the order, emit parenthesized items
+ * followed by a comma, and pass them to a second machine, which emits them
+ * again (see `FOREACH_I` in `macro_helpers.h`). Emitted tokens shall have
+ * balanced parentheses, and are macro-expanded at the iteration they are
+ * emitted, so the state stays constant-size.
+ *
  * @section cm_how_it_works How it works
  * `CM_EXEC_N` applies exponential number of rescans, so that `f` can
  * repeatedly be invoked on the state. By itself, it is heavy on preprocessor
@@ -64,6 +87,53 @@
  * internally, and puts `state` at the end of the replacement list so the whole
  * expression expands to `state`.
  *
+ * Termination does not unwind the rest of the ladder. Once `CM_RPAREN` is
+ * emitted, every pending `CM_EXECUTE_N`/`CM_CONTINUE_N` produces
+ * `CM_EXEC_N`/`CM_CONT_N` followed by a closing parenthesis instead of an
+ * argument list, so it is not invoked and leaves a single token behind. Only
+ * frames that were already open when `f` terminated are left to close, at most
+ * two per level, so the discarded tail is `O(CM_MAX_LEVEL)` tokens, and a
+ * deeper ladder does not make a short run any slower (see the `exit` workload
+ * in `bench/run_bench.py`). Each of those frames still passes the result
+ * through once.
+ *
+ * The ladder itself (`CM_EXEC_N`, `CM_CONT_N` and their `CM_EXECUTE_N`,
+ * `CM_CONTINUE_N` helpers) is generated by `tools/gen_ladder.py` and lives in
+ * `ladder/`. Define `CM_MAX_LEVEL` before including this header to select a
+ * deeper one. A ladder of level `L` allows at most `2^(L + 2) - 2` iterations:
+ * - `9` (default): 2046 iterations.
+ * - `12`: 16382 iterations.
+ * - `14`: 65534 iterations.
+ * - `16`: 262142 iterations.
+ *
+ * Only the selected ladder is included, and since iteration starts from
+ * `CM_CONT_0` either way, a deeper ladder costs nothing for short runs.
+ *
+ * The generator can also vary the growth factor of `CM_EXEC_N` (2, 3 or 4
+ * times per level) and the step of `CM_CONT_N` (including no ramp at all).
+ * Such ladders are selected by defining `CM_LADDER_HEADER` as the header name,
+ * e.g. `-DCM_LADDER_HEADER='"ladder/cm_ladder_x4_6.h"'`, which overrides
+ * `CM_MAX_LEVEL`. See `tools/gen_ladder.py --list` for checked-in presets.
+ *
+ * @section cm_ladder_selection Ladder selection
+ * How much a rescan costs differs between preprocessors, and so does the
+ * fastest ladder. By default every compiler gets the ladder of level 9, so a
+ * machine that runs on one compiler runs on the others, and `CM_STATS` reports
+ * the same level everywhere. Define `CM_LADDER_TUNED` (and neither
+ * `CM_MAX_LEVEL` nor `CM_LADDER_HEADER`) to get a ladder chosen for the
+ * compiler instead:
+ * - GCC: `ladder/cm_ladder_x4_6.h` (7286 iterations). With GCC 12 it is
+ *   5-20% faster than the default on the `cm`, `foreach` and `foreach_i`
+ *   workloads of `bench/run_bench.py` (`--ladder x2 x4 tuned`).
+ * - Clang and others: the default ladder of level 9, until there are numbers
+ *   showing that another one is faster.
+ * - MSVC: only its conforming preprocessor (`/Zc:preprocessor`) is supported,
+ *   and it uses the default ladder. The traditional one fails with `#error`.
+ *
+ * A tuned ladder allows more iterations than the default one, so a machine
+ * that needs more than 2046 of them fails with the default ladder, or on
+ * another compiler.
+ *
  * If number of iterations exceeds implementation limit, `CM_ABORT_ITER` is
  * called, which invokes `CM_ERROR_ITERATION_LIMIT_REACHED` with wrong number of
  * arguments, to intentionally fail preprocessing and display an error message.
@@ -78,6 +148,44 @@
  * `m` is time/space complexity of a single iteration (including number of
  * characters in the replacement list, number of macro calls, etc.).
  *
+ * @section cm_unroll Unrolled iteration
+ * `CM_UNROLL(k, f, initial_state, ...)` behaves like `CM`, but every leaf of
+ * the ladder applies `f` `k` times (`k` is one of 2, 4, 8, 16) before handing
+ * the state back. The machine runs the `UNROLL_k` transition and keeps the
+ * user's `f` in the state slot, i.e. its state is `(p, UNROLL_k, f, state,
+ * args...)`. Applications within a batch are chained with `CM_UNROLL_STEP`,
+ * the same way `CM_EXECUTE_0` chains `CM_EXEC_0`, so when `f` terminates
+ * partway through a batch, the remaining steps see `CM_RPAREN` instead of a
+ * state and are discarded along with the rest of the ladder.
+ *
+ * This divides the number of ladder frames by `k` and multiplies the iteration
+ * limit by `k`. The cost of a single application of `f` is not affected.
+ * Any other `k` invokes `CM_ERROR_UNSUPPORTED_UNROLL_FACTOR` with a wrong
+ * number of arguments, which fails preprocessing.
+ *
+ * @section cm_stats Statistics
+ * `CM_STATS(f, initial_state, ...)` runs the same machine as `CM`, and expands
+ * to `((result), iterations, level)`, followed by emitted tokens, if any:
+ * - `result`: what `CM` would expand to (nothing if `f` exits).
+ * - `iterations`: number of applications of `f`, as a decimal number.
+ * - `level`: highest `CM_CONT_N` reached, including the final application of
+ *   `CM_RETURN`. A ladder of level `L` fails after `CM_CONT_L`.
+ *
+ * `CM_STATS_RESULT(stats)`, `CM_STATS_ITERATIONS(stats)` and
+ * `CM_STATS_LEVEL(stats)` take them apart. Example:
+ *
+ * @code
+ * CM_STATS(REMOVE_COMMAS, CM_NO_STATE, 1, 2, 3) // expands to ((1 2 3), 3, 1)
+ * @endcode
+ *
+ * Everything is counted in the state, with digit lookup tables, so the result
+ * does not depend on `__COUNTER__` or anything else outside of the call. Levels
+ * are found from `CM_CONT_AT_N` marks, which `tools/gen_ladder.py` writes to
+ * every ladder. `f` can terminate either by returning `RETURN` or `EXIT` as the
+ * next transition or by invoking `CM_RETURN` or `CM_EXIT` itself, as
+ * `CM_FOREACH_DONE` of `macro_helpers.h` does, and `CM_EMIT` can be used. The
+ * counter makes every iteration about 4 times slower.
+ *
  * @note This macro is compliant with C99 and C11 standards.
  *
  * @note Ignoring the restriction of finite iteration count, and physical
@@ -89,52 +197,45 @@
 #define CM(f, initial_state, ...)                                              \
   EXPAND(DISCARD CM_LPAREN CM_CONT_0(, f, initial_state, __VA_ARGS__))
 
+#if defined(_MSC_VER) && !defined(__clang__) &&                               \
+    (!defined(_MSVC_TRADITIONAL) || _MSVC_TRADITIONAL)
+#error "CM needs the conforming preprocessor of MSVC (/Zc:preprocessor)"
+#endif
+
+/* ladder tuned for the compiler, if asked for and no other one is (see the
+ * `Ladder selection` section above) */
+#if defined(CM_LADDER_TUNED) && !defined(CM_LADDER_HEADER) &&                  \
+    !defined(CM_MAX_LEVEL)
+#if defined(__GNUC__) && !defined(__clang__)
+#define CM_LADDER_AUTO "ladder/cm_ladder_x4_6.h"
+#endif
+#endif
+
+#ifndef CM_MAX_LEVEL
+#define CM_MAX_LEVEL 9
+#endif
+
+#if defined(CM_LADDER_HEADER)
+#include CM_LADDER_HEADER
+#elif defined(CM_LADDER_AUTO)
+#include CM_LADDER_AUTO
+#elif CM_MAX_LEVEL == 9
+#include "ladder/cm_ladder_9.h"
+#elif CM_MAX_LEVEL == 12
+#include "ladder/cm_ladder_12.h"
+#elif CM_MAX_LEVEL == 14
+#include "ladder/cm_ladder_14.h"
+#elif CM_MAX_LEVEL == 16
+#include "ladder/cm_ladder_16.h"
+#else
+#error "CM_MAX_LEVEL shall be one of 9, 12, 14, 16 (see tools/gen_ladder.py)"
+#endif
+
 /* clang-format off */
-#define CM_EXEC_0(p, f, ...)                           CM_##f(, p##f, p##__VA_ARGS__)
-#define CM_EXEC_1(p, f, ...) CM_EXECUTE_0(CM_EXECUTE_0(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_2(p, f, ...) CM_EXECUTE_1(CM_EXECUTE_1(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_3(p, f, ...) CM_EXECUTE_2(CM_EXECUTE_2(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_4(p, f, ...) CM_EXECUTE_3(CM_EXECUTE_3(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_5(p, f, ...) CM_EXECUTE_4(CM_EXECUTE_4(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_6(p, f, ...) CM_EXECUTE_5(CM_EXECUTE_5(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_7(p, f, ...) CM_EXECUTE_6(CM_EXECUTE_6(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_8(p, f, ...) CM_EXECUTE_7(CM_EXECUTE_7(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_EXEC_9(p, f, ...) CM_EXECUTE_8(CM_EXECUTE_8(CM_##f(, p##f, p##__VA_ARGS__)))
-
-#define CM_CONT_0(p, f, ...) CM_CONTINUE_1(CM_EXECUTE_0(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_1(p, f, ...) CM_CONTINUE_2(CM_EXECUTE_1(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_2(p, f, ...) CM_CONTINUE_3(CM_EXECUTE_2(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_3(p, f, ...) CM_CONTINUE_4(CM_EXECUTE_3(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_4(p, f, ...) CM_CONTINUE_5(CM_EXECUTE_4(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_5(p, f, ...) CM_CONTINUE_6(CM_EXECUTE_5(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_6(p, f, ...) CM_CONTINUE_7(CM_EXECUTE_6(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_7(p, f, ...) CM_CONTINUE_8(CM_EXECUTE_7(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_8(p, f, ...) CM_CONTINUE_9(CM_EXECUTE_8(CM_##f(, p##f, p##__VA_ARGS__)))
-#define CM_CONT_9(p, f, ...) CM_ABORT_ITER(CM_EXECUTE_9(CM_##f(, p##f, p##__VA_ARGS__)))
-
-#define CM_EXECUTE_0(x)  CM_EXEC_0 x
-#define CM_EXECUTE_1(x)  CM_EXEC_1 x
-#define CM_EXECUTE_2(x)  CM_EXEC_2 x
-#define CM_EXECUTE_3(x)  CM_EXEC_3 x
-#define CM_EXECUTE_4(x)  CM_EXEC_4 x
-#define CM_EXECUTE_5(x)  CM_EXEC_5 x
-#define CM_EXECUTE_6(x)  CM_EXEC_6 x
-#define CM_EXECUTE_7(x)  CM_EXEC_7 x
-#define CM_EXECUTE_8(x)  CM_EXEC_8 x
-#define CM_EXECUTE_9(x)  CM_EXEC_9 x
-
-#define CM_CONTINUE_1(x)  CM_CONT_1 x
-#define CM_CONTINUE_2(x)  CM_CONT_2 x
-#define CM_CONTINUE_3(x)  CM_CONT_3 x
-#define CM_CONTINUE_4(x)  CM_CONT_4 x
-#define CM_CONTINUE_5(x)  CM_CONT_5 x
-#define CM_CONTINUE_6(x)  CM_CONT_6 x
-#define CM_CONTINUE_7(x)  CM_CONT_7 x
-#define CM_CONTINUE_8(x)  CM_CONT_8 x
-#define CM_CONTINUE_9(x)  CM_CONT_9 x
 #define CM_ABORT_ITER(x)  CM_ERROR_ITERATION_LIMIT_REACHED x /* intentionally wrong number of arguments to cause preprocessing error */
 
 #define CM_ERROR_ITERATION_LIMIT_REACHED() /* NOTE: if you see this in your error output, you're likely over the cm's iteration limit. */
+#define CM_ERROR_UNSUPPORTED_UNROLL_FACTOR() /* NOTE: if you see this in your error output, k of CM_UNROLL is not one of 2, 4, 8, 16. */
 /* clang-format on */
 
 #define CM_LPAREN (
@@ -143,3 +244,97 @@
 #define CM_NO_STATE ()
 #define CM_EXIT(...) CM_RPAREN
 #define CM_RETURN(p, f, state, ...) CM_EXIT() EXPAND state
+#define CM_EMIT(tokens, p, f, state, ...)                                      \
+  (p, f, state, __VA_ARGS__) UNPARENTHESIZE(tokens)
+
+#define CM_UNROLL(k, f, initial_state, ...)                                    \
+  IIF(CHECK(PRIMITIVE_CAT(CM_UNROLL_FACTOR_, k)))                              \
+  (CM, CM_ERROR_UNSUPPORTED_UNROLL_FACTOR)(UNROLL_##k, f, initial_state,       \
+                                           __VA_ARGS__)
+#define CM_UNROLL_FACTOR_2 ~, 1,
+#define CM_UNROLL_FACTOR_4 ~, 1,
+#define CM_UNROLL_FACTOR_8 ~, 1,
+#define CM_UNROLL_FACTOR_16 ~, 1,
+
+/* clang-format off */
+#define CM_UNROLL_2(p, f, uf, ...)  CM_UNROLL_PACK_2(CM_UNROLL_STEP(CM_##uf(, p##uf, p##__VA_ARGS__)))
+#define CM_UNROLL_4(p, f, uf, ...)  CM_UNROLL_PACK_4(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_##uf(, p##uf, p##__VA_ARGS__)))))
+#define CM_UNROLL_8(p, f, uf, ...)  CM_UNROLL_PACK_8(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_##uf(, p##uf, p##__VA_ARGS__)))))))))
+#define CM_UNROLL_16(p, f, uf, ...) CM_UNROLL_PACK_16(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_UNROLL_STEP(CM_##uf(, p##uf, p##__VA_ARGS__)))))))))))))))))
+
+#define CM_UNROLL_STEP(x) CM_UNROLL_APPLY x
+#define CM_UNROLL_APPLY(p, f, ...) CM_##f(, p##f, p##__VA_ARGS__)
+
+#define CM_UNROLL_PACK_2(x)  CM_UNROLL_REPACK_2 x
+#define CM_UNROLL_PACK_4(x)  CM_UNROLL_REPACK_4 x
+#define CM_UNROLL_PACK_8(x)  CM_UNROLL_REPACK_8 x
+#define CM_UNROLL_PACK_16(x) CM_UNROLL_REPACK_16 x
+
+#define CM_UNROLL_REPACK_2(p, f, ...)  (, UNROLL_2, p##f, p##__VA_ARGS__)
+#define CM_UNROLL_REPACK_4(p, f, ...)  (, UNROLL_4, p##f, p##__VA_ARGS__)
+#define CM_UNROLL_REPACK_8(p, f, ...)  (, UNROLL_8, p##f, p##__VA_ARGS__)
+#define CM_UNROLL_REPACK_16(p, f, ...) (, UNROLL_16, p##f, p##__VA_ARGS__)
+/* clang-format on */
+
+#define CM_STATS(f, initial_state, ...)                                        \
+  CM(STATS_STEP, (f, (0, 0, 0, 0, 0, 0), 0), initial_state, __VA_ARGS__)
+#define CM_STATS_RESULT(stats) CM_STATS_RESULT_ stats
+#define CM_STATS_RESULT_(result, iterations, level) EXPAND result
+#define CM_STATS_ITERATIONS(stats) CM_STATS_ITERATIONS_ stats
+#define CM_STATS_ITERATIONS_(result, iterations, level) iterations
+#define CM_STATS_LEVEL(stats) CM_STATS_LEVEL_ stats
+#define CM_STATS_LEVEL_(result, iterations, level) level
+
+/* `state` is (f, count, level): the user's transition, number of its
+ * applications so far, and the CM_CONT_N level of the next one. Both are
+ * updated before `f` is applied, and its result is split from tokens emitted
+ * with `CM_EMIT`. */
+#define CM_STATS_STEP(p, f, stats, ...)                                        \
+  CM_STATS_STEP_(p, CM_STATS_COUNT stats, p##__VA_ARGS__)
+#define CM_STATS_STEP_(...) CM_STATS_STEP__(__VA_ARGS__)
+#define CM_STATS_STEP__(p, f, count, level, ...)                               \
+  CM_STATS_NEXT(f, count, level, CM_STATS_CALL_(p, f, p##__VA_ARGS__))
+#define CM_STATS_CALL_(p, f, ...) CM_##f(, p##f, p##__VA_ARGS__)
+
+/* `f` that invokes `CM_RETURN` or `CM_EXIT` itself expands to `)` followed by
+ * the result, which closes CM_STATS_NEXT_ right after CM_STATS_SPLIT. The
+ * result is then enclosed by the parentheses opened by CM_STATS_RETURN and the
+ * tokens after CM_STATS_NEXT_, which otherwise are discarded at the next
+ * rescan. The count is only turned into a number there, so it costs nothing
+ * while the machine runs. */
+#define CM_STATS_NEXT(f, count, level, ...)                                    \
+  CM_STATS_NEXT_(count, level, CM_STATS_SPLIT __VA_ARGS__),                    \
+      DEFER(NARG_TO_NUMBER)(count), level)))
+#define CM_STATS_NEXT_(count, level, ...)                                      \
+  IIF(CHECK(CM_STATS_PROBE __VA_ARGS__))                                       \
+  (CM_STATS_MACHINE, CM_STATS_RETURN)(count, level, __VA_ARGS__)
+#define CM_STATS_MACHINE(count, level, machine, ...)                           \
+  CM_STATS_REPACK(count, level, EXPAND machine)                                \
+  __VA_ARGS__ DISCARD CM_LPAREN CM_LPAREN CM_LPAREN
+#define CM_STATS_RETURN(...) (, RETURN, (((
+#define CM_STATS_SPLIT(...) (__VA_ARGS__),
+#define CM_STATS_PROBE(...) ~, 1,
+
+#define CM_STATS_COUNT(f, count, level)                                        \
+  CM_STATS_COUNT_(f, NARG_ADD(count, 0, 1), level)
+#define CM_STATS_COUNT_(f, count, level) f, count, CM_STATS_AT(count, level)
+
+/* level changes once the count reaches the end of a CM_CONT_N, which is marked
+ * by the ladder with `CM_CONT_AT_<count>` */
+#define CM_STATS_AT(count, level)                                              \
+  CM_STATS_AT_(CAT(CM_CONT_AT_, DIGITS_CAT_6 count), level)
+#define CM_STATS_AT_(...) CHECK_N(__VA_ARGS__, )
+
+#define CM_STATS_REPACK(...) CM_STATS_REPACK_(__VA_ARGS__)
+#define CM_STATS_REPACK_(count, level, p, f, ...)                              \
+  IIF(CM_STATS_IS_DONE(f))                                                     \
+  (CM_STATS_DONE_##f, CM_STATS_KEEP)(count, level, f, p##__VA_ARGS__)
+#define CM_STATS_KEEP(count, level, f, ...)                                    \
+  (, STATS_STEP, (f, count, level), __VA_ARGS__)
+#define CM_STATS_DONE_RETURN(count, level, f, state, ...)                      \
+  (, RETURN, ((state, NARG_TO_NUMBER(count), level)))
+#define CM_STATS_DONE_EXIT(count, level, f, ...)                               \
+  (, RETURN, (((), NARG_TO_NUMBER(count), level)))
+#define CM_STATS_IS_DONE(f) CHECK(CAT(CM_STATS_FINAL_, f))
+#define CM_STATS_FINAL_RETURN ~, 1,
+#define CM_STATS_FINAL_EXIT ~, 1,
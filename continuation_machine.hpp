@@ -0,0 +1,115 @@
+/**
+ * @file continuation_machine.hpp
+ * @brief Continuation machine evaluated by the C++20 constant evaluator.
+ *
+ * @section cmpp_usage Usage
+ * When the result of a machine is a value rather than code, the compiler can
+ * compute it instead of the preprocessor. `cm::run(f, initial_state, ...)` is
+ * `CM(f, initial_state, ...)` with a `consteval` loop in place of the ladder.
+ * Example:
+ *
+ * @code
+ * #include "continuation_machine.hpp"
+ *
+ * constexpr cm::machine<int, int> add(int sum, std::span<const int> args) {
+ *   if (args.empty()) return cm::ret(sum);
+ *   return cm::next(add, sum + args[0], args.subspan(1));
+ * }
+ *
+ * static_assert(cm::run(add, 0, 1, 2, 3) == 6);
+ * @endcode
+ *
+ * Arguments of `cm::run`:
+ * - `f`: **Transition function** of the form `(state, args) -> machine`, where
+ * `args` is a span of the arguments left to process. It is the first function
+ * invoked, like `CM_f` in `CM(f, ...)`.
+ * - `initial_state`: a value of any literal type.
+ * - `...`: arguments for the machine to process, converted to the argument
+ * type of `f`. Pass numbers, enumerators or `std::string_view`s where the
+ * macro version takes tokens.
+ *
+ * A transition function returns one of:
+ * - `cm::next(g, state, args)`: continue with `g` (usually the same function)
+ * on the new state and the remaining arguments, like `(, g, state, args...)`.
+ * - `cm::ret(state)`: like `CM_RETURN`, `cm::run` returns `state`.
+ * - `cm::exit()`: like `CM_EXIT`, `cm::run` returns a value-initialized state.
+ *
+ * Unlike the macro version, `f` is a plain function, so it may call
+ * `cm::run` itself, and the state and arguments are typed values, so there is
+ * no `p` and nothing has to be parenthesized. Code cannot be emitted, so
+ * there is no `CM_EMIT`.
+ *
+ * @note The number of iterations is limited by `CM_MAX_ITERATIONS` (262142,
+ * as the deepest ladder, by default) and by the constant evaluator itself
+ * (e.g. `-fconstexpr-ops-limit` of GCC, `-fconstexpr-steps` of Clang). Going
+ * over the former calls `cm_error_iteration_limit_reached`, which is not
+ * `constexpr`, so compilation fails.
+ *
+ * `bench/cpp_bench.py` compares compile time and memory with the macro
+ * version.
+ */
+#pragma once
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#ifndef CM_MAX_ITERATIONS
+#define CM_MAX_ITERATIONS 262142
+#endif
+
+namespace cm {
+
+template <class State, class Arg> struct machine;
+
+template <class State, class Arg>
+using transition = machine<State, Arg> (*)(State, std::span<const Arg>);
+
+template <class State> struct returned {
+  State state;
+};
+
+struct exited {};
+
+/* machine state: `f` is null once the machine has returned or exited */
+template <class State, class Arg> struct machine {
+  transition<State, Arg> f;
+  State state;
+  std::span<const Arg> args;
+
+  constexpr machine(transition<State, Arg> f, State state,
+                    std::span<const Arg> args)
+      : f(f), state(state), args(args) {}
+  constexpr machine(returned<State> r) : f(nullptr), state(r.state), args() {}
+  constexpr machine(exited) : f(nullptr), state(), args() {}
+};
+
+template <class State, class Arg>
+constexpr machine<State, Arg> next(transition<State, Arg> f,
+                                   std::type_identity_t<State> state,
+                                   std::span<const Arg> args) {
+  return {f, state, args};
+}
+
+template <class State> constexpr returned<State> ret(State state) {
+  return {state};
+}
+
+constexpr exited exit() { return {}; }
+
+inline void cm_error_iteration_limit_reached() {}
+
+template <class State, class Arg, class... Args>
+consteval State run(transition<State, Arg> f,
+                    std::type_identity_t<State> initial_state,
+                    const Args &...args) {
+  const std::array<Arg, sizeof...(Args)> list{Arg(args)...};
+  machine<State, Arg> m{f, initial_state, list};
+  for (std::size_t i = 0; m.f; i++) {
+    if (i == CM_MAX_ITERATIONS) cm_error_iteration_limit_reached();
+    m = m.f(m.state, m.args);
+  }
+  return m.state;
+}
+
+} // namespace cm
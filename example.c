@@ -1,12 +1,17 @@
 #include "continuation_machine.h"
 #include <stdio.h>
 
-#undef CM_ERROR_ITERATION_LIMIT_REACHED
-#define CM_ERROR_ITERATION_LIMIT_REACHED(p, f, state, ...)                        \
-  CM_RETURN(, f, state, __VA_ARGS__)
-#define CM_ADD(p, f, state, ...) (, f, (__COUNTER__), state)
+#define CM_REMOVE_COMMAS(p, f, state, current_arg, ...)                        \
+  (, IF(IS_EMPTY(__VA_ARGS__))(RETURN, f), (EXPAND state current_arg),         \
+   __VA_ARGS__)
+
+#define STATS CM_STATS(REMOVE_COMMAS, CM_NO_STATE, 1, 2, 3, 4, 5, 6, 7, 8, 9)
+#define STRINGIZE(...) STRINGIZE_(__VA_ARGS__)
+#define STRINGIZE_(...) #__VA_ARGS__
 
 int main() {
-  printf("CM iteration count: %i\n", CM(ADD, CM_NO_STATE));
+  printf("CM result: %s\n", STRINGIZE(CM_STATS_RESULT(STATS)));
+  printf("CM iteration count: %i, CM_CONT level: %i\n",
+         CM_STATS_ITERATIONS(STATS), CM_STATS_LEVEL(STATS));
   return 0;
-}
\ No newline at end of file
+}
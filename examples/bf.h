@@ -0,0 +1,401 @@
+/**
+ * @file bf.h
+ * @brief Brainfuck interpreter running entirely in the preprocessor.
+ *
+ * @section bf_usage Usage
+ * Instructions are spelled as identifiers, separated by commas:
+ *
+ * | `+`   | `-`   | `>`    | `<`    | `.`   | `,`   | `[`    | `]`   |
+ * |-------|-------|--------|--------|-------|-------|--------|-------|
+ * | `INC` | `DEC` | `NEXT` | `PREV` | `PUT` | `GET` | `LOOP` | `END` |
+ *
+ * `BF(input, program...)` expands to the bytes written by `PUT`, separated by
+ * commas. `input` is a sequence of bytes read by `GET`, like `(104)(105)`, or
+ * `SEQ_NIL`. Example:
+ *
+ * @code
+ * #define CM_MAX_LEVEL 12
+ * #include "examples/bf.h"
+ *
+ * // reads two bytes, prints their sum
+ * char sum[] = {BF((3)(4), GET, NEXT, GET, LOOP, DEC, PREV, INC, NEXT, END,
+ *                  PREV, PUT)}; // expands to {7}
+ * @endcode
+ *
+ * Cells are bytes that wrap around, and the tape is unbounded in both
+ * directions. `GET` past the end of input stores 0. Brackets shall be
+ * balanced, the program shall have at least one instruction, and instruction
+ * names shall not be defined as macros.
+ *
+ * @section bf_how How it works
+ * Two machines are run. The first one parses the program into a sequence (see
+ * `cm_seq.h`) where every loop is a single element holding its body, like
+ * `(LOOP, (DEC)(NEXT))`. The second one executes one instruction per
+ * iteration on the state `(left, cell, right, input, output, code)`:
+ * - `left` and `right` are sequences of cells on either side of the head,
+ *   nearest first, so moving the head pops one of them and pushes to the
+ *   other. Cells that were never visited are not stored.
+ * - `code` is the sequence of instructions left to execute. A loop whose cell
+ *   is not zero is replaced with its body, followed by the loop itself.
+ * - `output` is a sequence of bytes, joined with commas at the end.
+ *
+ * Each instruction takes a constant number of invocations: it is dispatched by
+ * pasting its name, and cell arithmetic and zero checks are lookup tables.
+ * Instructions in `code` are not macros themselves, since the name of a macro
+ * met while its own expansion is rescanned could never be expanded again.
+ *
+ * @note Every iteration still copies the whole state, so the cost of an
+ * instruction grows with the length of the program, the visited part of the
+ * tape and the output. Long programs need a deeper ladder (`CM_MAX_LEVEL`):
+ * the parser takes one iteration per instruction, and the interpreter one per
+ * executed instruction, plus one.
+ */
+#pragma once
+#include "../cm_seq.h"
+#include "../continuation_machine.h"
+
+#define BF(in, ...)                                                            \
+  CM(BF_STEP, SEQ_NIL, 0, SEQ_NIL, in, SEQ_NIL,                                \
+     CM(BF_PARSE, (SEQ_NIL), __VA_ARGS__))
+
+/* parser: the state is a stack of bodies of unclosed loops, innermost first,
+ * each in parentheses. END marks the end of the parsed program. */
+#define CM_BF_PARSE(p, f, stack, x, ...)                                       \
+  (, IF(IS_EMPTY(__VA_ARGS__))(BF_PARSE_DONE, f),                              \
+   BF_PARSE_APPLY(stack, BF_TOKEN_##x), __VA_ARGS__)
+#define CM_BF_PARSE_DONE(p, f, stack, ...)                                     \
+  CM_RETURN(p, f, (SEQ_HEAD(stack)(END)))
+
+#define BF_PARSE_APPLY(...) BF_PARSE_APPLY_(__VA_ARGS__)
+#define BF_PARSE_APPLY_(stack, op, ...) op(stack, __VA_ARGS__)
+
+#define BF_TOKEN_INC BF_PARSE_PUSH, (INC)
+#define BF_TOKEN_DEC BF_PARSE_PUSH, (DEC)
+#define BF_TOKEN_NEXT BF_PARSE_PUSH, (NEXT)
+#define BF_TOKEN_PREV BF_PARSE_PUSH, (PREV)
+#define BF_TOKEN_PUT BF_PARSE_PUSH, (PUT)
+#define BF_TOKEN_GET BF_PARSE_PUSH, (GET)
+#define BF_TOKEN_LOOP BF_PARSE_OPEN,
+#define BF_TOKEN_END BF_PARSE_CLOSE,
+
+#define BF_PARSE_PUSH(stack, instr) BF_PARSE_PUSH_(instr, BF_SPLIT stack)
+#define BF_PARSE_PUSH_(...) BF_PARSE_PUSH__(__VA_ARGS__)
+#define BF_PARSE_PUSH__(instr, body, rest) (body instr) rest
+#define BF_PARSE_OPEN(stack, ...) (SEQ_NIL) stack
+#define BF_PARSE_CLOSE(stack, ...) BF_PARSE_CLOSE_(BF_SPLIT stack)
+#define BF_PARSE_CLOSE_(...) BF_PARSE_CLOSE__(__VA_ARGS__)
+#define BF_PARSE_CLOSE__(body, rest) BF_PARSE_PUSH(rest, (LOOP, body))
+
+/* moves the first element out of a sequence: `x, rest` */
+#define BF_SPLIT(...) __VA_ARGS__,
+
+/* interpreter: instructions are invoked on (left, cell, right, in, out,
+ * rest of code, operand) and expand to the next machine state */
+#define CM_BF_STEP(p, f, left, cell, right, in, out, code)                     \
+  BF_EXEC(p, f, left, cell, right, in, out, BF_HEAD_SPLIT code)
+#define BF_HEAD_SPLIT(...) (__VA_ARGS__),
+#define BF_EXEC(...) BF_EXEC_(__VA_ARGS__)
+#define BF_EXEC_(p, f, left, cell, right, in, out, instr, rest)                \
+  BF_CALL(p, f, left, cell, right, in, out, rest, EXPAND instr)
+#define BF_CALL(...) BF_CALL_(__VA_ARGS__)
+#define BF_CALL_(p, f, left, cell, right, in, out, rest, op, ...)              \
+  BF_OP_##op(p, f, left, cell, right, in, out, rest, __VA_ARGS__)
+
+#define BF_STATE(...) (, BF_STEP, __VA_ARGS__)
+
+#define BF_OP_INC(p, f, left, cell, right, in, out, rest, ...)                 \
+  BF_STATE(left, BF_CELL_INC(BF_CELL_##cell), right, in, out, rest)
+#define BF_OP_DEC(p, f, left, cell, right, in, out, rest, ...)                 \
+  BF_STATE(left, BF_CELL_DEC(BF_CELL_##cell), right, in, out, rest)
+#define BF_OP_NEXT(p, f, left, cell, right, in, out, rest, ...)                \
+  BF_STATE((cell) left, BF_SHIFT(right), in, out, rest)
+#define BF_OP_PREV(p, f, left, cell, right, in, out, rest, ...)                \
+  BF_STATE(BF_SWAP(BF_SHIFT(left)), (cell) right, in, out, rest)
+#define BF_OP_PUT(p, f, left, cell, right, in, out, rest, ...)                 \
+  BF_STATE(left, cell, right, in, out(cell), rest)
+#define BF_OP_GET(p, f, left, cell, right, in, out, rest, ...)                 \
+  BF_GET_(left, right, out, rest, BF_SHIFT(in))
+#define BF_GET_(...) BF_GET__(__VA_ARGS__)
+#define BF_GET__(left, right, out, rest, x, in)                                \
+  BF_STATE(left, x, right, in, out, rest)
+#define BF_OP_LOOP(p, f, left, cell, right, in, out, rest, body)               \
+  BF_STATE(left, cell, right, in, out,                                         \
+           IIF(BF_IS_ZERO(cell))(rest, body(LOOP, body) rest))
+#define BF_OP_END(p, f, left, cell, right, in, out, rest, ...)                 \
+  CM_RETURN(p, f, (SEQ_ENUM(out)))
+
+/* first element of a sequence and the rest of it, or 0 if it is empty */
+#define BF_SHIFT(seq)                                                          \
+  IIF(SEQ_IS_EMPTY(seq))(BF_SHIFT_ZERO, BF_SHIFT_HEAD)(seq)
+#define BF_SHIFT_ZERO(seq) 0,
+#define BF_SHIFT_HEAD(seq) BF_SPLIT seq
+#define BF_SWAP(...) BF_SWAP_(__VA_ARGS__)
+#define BF_SWAP_(x, seq) seq, x
+
+#define BF_IS_ZERO(cell) CHECK(BF_ZERO_##cell)
+#define BF_ZERO_0 ~, 1,
+
+#define BF_CELL_INC(...) BF_CELL_INC_(__VA_ARGS__)
+#define BF_CELL_INC_(inc, dec) inc
+#define BF_CELL_DEC(...) BF_CELL_DEC_(__VA_ARGS__)
+#define BF_CELL_DEC_(inc, dec) dec
+
+/* BF_CELL_n: n + 1, n - 1, modulo 256 */
+/* clang-format off */
+#define BF_CELL_0 1, 255
+#define BF_CELL_1 2, 0
+#define BF_CELL_2 3, 1
+#define BF_CELL_3 4, 2
+#define BF_CELL_4 5, 3
+#define BF_CELL_5 6, 4
+#define BF_CELL_6 7, 5
+#define BF_CELL_7 8, 6
+#define BF_CELL_8 9, 7
+#define BF_CELL_9 10, 8
+#define BF_CELL_10 11, 9
+#define BF_CELL_11 12, 10
+#define BF_CELL_12 13, 11
+#define BF_CELL_13 14, 12
+#define BF_CELL_14 15, 13
+#define BF_CELL_15 16, 14
+#define BF_CELL_16 17, 15
+#define BF_CELL_17 18, 16
+#define BF_CELL_18 19, 17
+#define BF_CELL_19 20, 18
+#define BF_CELL_20 21, 19
+#define BF_CELL_21 22, 20
+#define BF_CELL_22 23, 21
+#define BF_CELL_23 24, 22
+#define BF_CELL_24 25, 23
+#define BF_CELL_25 26, 24
+#define BF_CELL_26 27, 25
+#define BF_CELL_27 28, 26
+#define BF_CELL_28 29, 27
+#define BF_CELL_29 30, 28
+#define BF_CELL_30 31, 29
+#define BF_CELL_31 32, 30
+#define BF_CELL_32 33, 31
+#define BF_CELL_33 34, 32
+#define BF_CELL_34 35, 33
+#define BF_CELL_35 36, 34
+#define BF_CELL_36 37, 35
+#define BF_CELL_37 38, 36
+#define BF_CELL_38 39, 37
+#define BF_CELL_39 40, 38
+#define BF_CELL_40 41, 39
+#define BF_CELL_41 42, 40
+#define BF_CELL_42 43, 41
+#define BF_CELL_43 44, 42
+#define BF_CELL_44 45, 43
+#define BF_CELL_45 46, 44
+#define BF_CELL_46 47, 45
+#define BF_CELL_47 48, 46
+#define BF_CELL_48 49, 47
+#define BF_CELL_49 50, 48
+#define BF_CELL_50 51, 49
+#define BF_CELL_51 52, 50
+#define BF_CELL_52 53, 51
+#define BF_CELL_53 54, 52
+#define BF_CELL_54 55, 53
+#define BF_CELL_55 56, 54
+#define BF_CELL_56 57, 55
+#define BF_CELL_57 58, 56
+#define BF_CELL_58 59, 57
+#define BF_CELL_59 60, 58
+#define BF_CELL_60 61, 59
+#define BF_CELL_61 62, 60
+#define BF_CELL_62 63, 61
+#define BF_CELL_63 64, 62
+#define BF_CELL_64 65, 63
+#define BF_CELL_65 66, 64
+#define BF_CELL_66 67, 65
+#define BF_CELL_67 68, 66
+#define BF_CELL_68 69, 67
+#define BF_CELL_69 70, 68
+#define BF_CELL_70 71, 69
+#define BF_CELL_71 72, 70
+#define BF_CELL_72 73, 71
+#define BF_CELL_73 74, 72
+#define BF_CELL_74 75, 73
+#define BF_CELL_75 76, 74
+#define BF_CELL_76 77, 75
+#define BF_CELL_77 78, 76
+#define BF_CELL_78 79, 77
+#define BF_CELL_79 80, 78
+#define BF_CELL_80 81, 79
+#define BF_CELL_81 82, 80
+#define BF_CELL_82 83, 81
+#define BF_CELL_83 84, 82
+#define BF_CELL_84 85, 83
+#define BF_CELL_85 86, 84
+#define BF_CELL_86 87, 85
+#define BF_CELL_87 88, 86
+#define BF_CELL_88 89, 87
+#define BF_CELL_89 90, 88
+#define BF_CELL_90 91, 89
+#define BF_CELL_91 92, 90
+#define BF_CELL_92 93, 91
+#define BF_CELL_93 94, 92
+#define BF_CELL_94 95, 93
+#define BF_CELL_95 96, 94
+#define BF_CELL_96 97, 95
+#define BF_CELL_97 98, 96
+#define BF_CELL_98 99, 97
+#define BF_CELL_99 100, 98
+#define BF_CELL_100 101, 99
+#define BF_CELL_101 102, 100
+#define BF_CELL_102 103, 101
+#define BF_CELL_103 104, 102
+#define BF_CELL_104 105, 103
+#define BF_CELL_105 106, 104
+#define BF_CELL_106 107, 105
+#define BF_CELL_107 108, 106
+#define BF_CELL_108 109, 107
+#define BF_CELL_109 110, 108
+#define BF_CELL_110 111, 109
+#define BF_CELL_111 112, 110
+#define BF_CELL_112 113, 111
+#define BF_CELL_113 114, 112
+#define BF_CELL_114 115, 113
+#define BF_CELL_115 116, 114
+#define BF_CELL_116 117, 115
+#define BF_CELL_117 118, 116
+#define BF_CELL_118 119, 117
+#define BF_CELL_119 120, 118
+#define BF_CELL_120 121, 119
+#define BF_CELL_121 122, 120
+#define BF_CELL_122 123, 121
+#define BF_CELL_123 124, 122
+#define BF_CELL_124 125, 123
+#define BF_CELL_125 126, 124
+#define BF_CELL_126 127, 125
+#define BF_CELL_127 128, 126
+#define BF_CELL_128 129, 127
+#define BF_CELL_129 130, 128
+#define BF_CELL_130 131, 129
+#define BF_CELL_131 132, 130
+#define BF_CELL_132 133, 131
+#define BF_CELL_133 134, 132
+#define BF_CELL_134 135, 133
+#define BF_CELL_135 136, 134
+#define BF_CELL_136 137, 135
+#define BF_CELL_137 138, 136
+#define BF_CELL_138 139, 137
+#define BF_CELL_139 140, 138
+#define BF_CELL_140 141, 139
+#define BF_CELL_141 142, 140
+#define BF_CELL_142 143, 141
+#define BF_CELL_143 144, 142
+#define BF_CELL_144 145, 143
+#define BF_CELL_145 146, 144
+#define BF_CELL_146 147, 145
+#define BF_CELL_147 148, 146
+#define BF_CELL_148 149, 147
+#define BF_CELL_149 150, 148
+#define BF_CELL_150 151, 149
+#define BF_CELL_151 152, 150
+#define BF_CELL_152 153, 151
+#define BF_CELL_153 154, 152
+#define BF_CELL_154 155, 153
+#define BF_CELL_155 156, 154
+#define BF_CELL_156 157, 155
+#define BF_CELL_157 158, 156
+#define BF_CELL_158 159, 157
+#define BF_CELL_159 160, 158
+#define BF_CELL_160 161, 159
+#define BF_CELL_161 162, 160
+#define BF_CELL_162 163, 161
+#define BF_CELL_163 164, 162
+#define BF_CELL_164 165, 163
+#define BF_CELL_165 166, 164
+#define BF_CELL_166 167, 165
+#define BF_CELL_167 168, 166
+#define BF_CELL_168 169, 167
+#define BF_CELL_169 170, 168
+#define BF_CELL_170 171, 169
+#define BF_CELL_171 172, 170
+#define BF_CELL_172 173, 171
+#define BF_CELL_173 174, 172
+#define BF_CELL_174 175, 173
+#define BF_CELL_175 176, 174
+#define BF_CELL_176 177, 175
+#define BF_CELL_177 178, 176
+#define BF_CELL_178 179, 177
+#define BF_CELL_179 180, 178
+#define BF_CELL_180 181, 179
+#define BF_CELL_181 182, 180
+#define BF_CELL_182 183, 181
+#define BF_CELL_183 184, 182
+#define BF_CELL_184 185, 183
+#define BF_CELL_185 186, 184
+#define BF_CELL_186 187, 185
+#define BF_CELL_187 188, 186
+#define BF_CELL_188 189, 187
+#define BF_CELL_189 190, 188
+#define BF_CELL_190 191, 189
+#define BF_CELL_191 192, 190
+#define BF_CELL_192 193, 191
+#define BF_CELL_193 194, 192
+#define BF_CELL_194 195, 193
+#define BF_CELL_195 196, 194
+#define BF_CELL_196 197, 195
+#define BF_CELL_197 198, 196
+#define BF_CELL_198 199, 197
+#define BF_CELL_199 200, 198
+#define BF_CELL_200 201, 199
+#define BF_CELL_201 202, 200
+#define BF_CELL_202 203, 201
+#define BF_CELL_203 204, 202
+#define BF_CELL_204 205, 203
+#define BF_CELL_205 206, 204
+#define BF_CELL_206 207, 205
+#define BF_CELL_207 208, 206
+#define BF_CELL_208 209, 207
+#define BF_CELL_209 210, 208
+#define BF_CELL_210 211, 209
+#define BF_CELL_211 212, 210
+#define BF_CELL_212 213, 211
+#define BF_CELL_213 214, 212
+#define BF_CELL_214 215, 213
+#define BF_CELL_215 216, 214
+#define BF_CELL_216 217, 215
+#define BF_CELL_217 218, 216
+#define BF_CELL_218 219, 217
+#define BF_CELL_219 220, 218
+#define BF_CELL_220 221, 219
+#define BF_CELL_221 222, 220
+#define BF_CELL_222 223, 221
+#define BF_CELL_223 224, 222
+#define BF_CELL_224 225, 223
+#define BF_CELL_225 226, 224
+#define BF_CELL_226 227, 225
+#define BF_CELL_227 228, 226
+#define BF_CELL_228 229, 227
+#define BF_CELL_229 230, 228
+#define BF_CELL_230 231, 229
+#define BF_CELL_231 232, 230
+#define BF_CELL_232 233, 231
+#define BF_CELL_233 234, 232
+#define BF_CELL_234 235, 233
+#define BF_CELL_235 236, 234
+#define BF_CELL_236 237, 235
+#define BF_CELL_237 238, 236
+#define BF_CELL_238 239, 237
+#define BF_CELL_239 240, 238
+#define BF_CELL_240 241, 239
+#define BF_CELL_241 242, 240
+#define BF_CELL_242 243, 241
+#define BF_CELL_243 244, 242
+#define BF_CELL_244 245, 243
+#define BF_CELL_245 246, 244
+#define BF_CELL_246 247, 245
+#define BF_CELL_247 248, 246
+#define BF_CELL_248 249, 247
+#define BF_CELL_249 250, 248
+#define BF_CELL_250 251, 249
+#define BF_CELL_251 252, 250
+#define BF_CELL_252 253, 251
+#define BF_CELL_253 254, 252
+#define BF_CELL_254 255, 253
+#define BF_CELL_255 0, 254
+/* clang-format on */
@@ -0,0 +1,49 @@
+/**
+ * @file cm_ladder_x4_6.h
+ * @brief Level 6 ladder for continuation_machine.h (at most 7286 iterations).
+ *
+ * Branching factor 4, CM_CONT_N step 1.
+ *
+ * Generated by tools/gen_ladder.py. Do not edit.
+ */
+#pragma once
+
+/* clang-format off */
+#define CM_EXEC_0(p, f, ...)                                                     CM_##f(, p##f, p##__VA_ARGS__)
+#define CM_EXEC_1(p, f, ...) CM_EXECUTE_0(CM_EXECUTE_0(CM_EXECUTE_0(CM_EXECUTE_0(CM_##f(, p##f, p##__VA_ARGS__)))))
+#define CM_EXEC_2(p, f, ...) CM_EXECUTE_1(CM_EXECUTE_1(CM_EXECUTE_1(CM_EXECUTE_1(CM_##f(, p##f, p##__VA_ARGS__)))))
+#define CM_EXEC_3(p, f, ...) CM_EXECUTE_2(CM_EXECUTE_2(CM_EXECUTE_2(CM_EXECUTE_2(CM_##f(, p##f, p##__VA_ARGS__)))))
+#define CM_EXEC_4(p, f, ...) CM_EXECUTE_3(CM_EXECUTE_3(CM_EXECUTE_3(CM_EXECUTE_3(CM_##f(, p##f, p##__VA_ARGS__)))))
+#define CM_EXEC_5(p, f, ...) CM_EXECUTE_4(CM_EXECUTE_4(CM_EXECUTE_4(CM_EXECUTE_4(CM_##f(, p##f, p##__VA_ARGS__)))))
+#define CM_EXEC_6(p, f, ...) CM_EXECUTE_5(CM_EXECUTE_5(CM_EXECUTE_5(CM_EXECUTE_5(CM_##f(, p##f, p##__VA_ARGS__)))))
+
+#define CM_CONT_0(p, f, ...) CM_CONTINUE_1(CM_EXECUTE_0(CM_##f(, p##f, p##__VA_ARGS__)))
+#define CM_CONT_1(p, f, ...) CM_CONTINUE_2(CM_EXECUTE_1(CM_##f(, p##f, p##__VA_ARGS__)))
+#define CM_CONT_2(p, f, ...) CM_CONTINUE_3(CM_EXECUTE_2(CM_##f(, p##f, p##__VA_ARGS__)))
+#define CM_CONT_3(p, f, ...) CM_CONTINUE_4(CM_EXECUTE_3(CM_##f(, p##f, p##__VA_ARGS__)))
+#define CM_CONT_4(p, f, ...) CM_CONTINUE_5(CM_EXECUTE_4(CM_##f(, p##f, p##__VA_ARGS__)))
+#define CM_CONT_5(p, f, ...) CM_CONTINUE_6(CM_EXECUTE_5(CM_##f(, p##f, p##__VA_ARGS__)))
+#define CM_CONT_6(p, f, ...) CM_ABORT_ITER(CM_EXECUTE_6(CM_##f(, p##f, p##__VA_ARGS__)))
+
+#define CM_EXECUTE_0(x)  CM_EXEC_0 x
+#define CM_EXECUTE_1(x)  CM_EXEC_1 x
+#define CM_EXECUTE_2(x)  CM_EXEC_2 x
+#define CM_EXECUTE_3(x)  CM_EXEC_3 x
+#define CM_EXECUTE_4(x)  CM_EXEC_4 x
+#define CM_EXECUTE_5(x)  CM_EXEC_5 x
+#define CM_EXECUTE_6(x)  CM_EXEC_6 x
+
+#define CM_CONTINUE_1(x)  CM_CONT_1 x
+#define CM_CONTINUE_2(x)  CM_CONT_2 x
+#define CM_CONTINUE_3(x)  CM_CONT_3 x
+#define CM_CONTINUE_4(x)  CM_CONT_4 x
+#define CM_CONTINUE_5(x)  CM_CONT_5 x
+#define CM_CONTINUE_6(x)  CM_CONT_6 x
+
+#define CM_CONT_AT_000002 ~, 1,
+#define CM_CONT_AT_000008 ~, 2,
+#define CM_CONT_AT_000030 ~, 3,
+#define CM_CONT_AT_000116 ~, 4,
+#define CM_CONT_AT_000458 ~, 5,
+#define CM_CONT_AT_001824 ~, 6,
+/* clang-format on */
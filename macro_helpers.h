@@ -1,17 +1,7 @@
 #pragma once
+#include "macro_primitives.h"
 #include "continuation_machine.h"
-
-#define DISCARD(...)
-
-#define PARENTHESIZE(...) (__VA_ARGS__)
-
-/* removes parentheses from passed argument */
-#define EXPAND(...) __VA_ARGS__
-#define EMPTY()
-#define DEFER(...) __VA_ARGS__ EMPTY()
-#define UNPARENTHESIZE(arg) EXPAND arg
-
-#define FIRST_ARG(arg, ...) arg
+#include "cm_seq.h"
 
 /* counting number of elements in a comma separated token list */
 #define PP_NARG(...) PP_NARG_(__VA_ARGS__ __VA_OPT__(, ) PP_RSEQ_N())
@@ -29,33 +19,520 @@
       44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,  \
       26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,   \
       8, 7, 6, 5, 4, 3, 2, 1, 0
+
 #define N_ARGS(...) PP_NARG(__VA_ARGS__)
 
-#define CAT(a, ...) PRIMITIVE_CAT(a, __VA_ARGS__)
-#define PRIMITIVE_CAT(a, ...) a##__VA_ARGS__
+/* counting number of elements in a comma separated token list of any length
+ * (up to 999999, and 63 elements per CM iteration). Expands to a decimal
+ * number. Elements shall not end with a name of function-like macro, since
+ * `()` is appended to the 64th one to tell whether it is there (see
+ * `NARG_HAS_64`). Built on `CM`, so unlike `N_ARGS` it cannot be used inside
+ * a transition function. */
+#define N_ARGS_LONG(...) CM(NARG_CHUNK, (0, 0, 0, 0, 0, 0), __VA_ARGS__)
+
+#define CM_NARG_CHUNK(p, f, count, ...)                                        \
+  IIF(NARG_HAS_64(__VA_ARGS__))(NARG_NEXT, NARG_LAST)(f, count, __VA_ARGS__)
+
+#define NARG_NEXT(f, count, ...)                                               \
+  (, f, NARG_ADD(count, 6, 3), NARG_DROP_63(__VA_ARGS__))
+#define NARG_LAST(f, count, ...)                                               \
+  (, RETURN,                                                                   \
+   (NARG_TO_NUMBER(NARG_ADD(count, UNPARENTHESIZE(PP_NARG_(                    \
+       __VA_ARGS__ __VA_OPT__(, ) NARG_RSEQ_DIGITS()))))))
+
+/* 64th element is `NARG_MARK` unless the list has at least 64 elements */
+#define NARG_HAS_64(...)                                                       \
+  COMPL(CHECK(PP_NARG_(__VA_ARGS__, NARG_MARKS()) ()))
+#define NARG_MARK() ~, 1,
+#define NARG_MARKS()                                                           \
+  NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,        \
+      NARG_MARK, NARG_MARK, NARG_MARK
+
+#define NARG_DROP_63(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13,   \
+                     _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24,    \
+                     _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35,    \
+                     _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46,    \
+                     _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57,    \
+                     _58, _59, _60, _61, _62, _63, ...)                        \
+  __VA_ARGS__
+
+/* same as PP_RSEQ_N, but each number is split into (tens, units) */
+#define NARG_RSEQ_DIGITS()                                                     \
+  (6, 3), (6, 2), (6, 1), (6, 0), (5, 9), (5, 8), (5, 7), (5, 6), (5, 5),      \
+      (5, 4), (5, 3), (5, 2), (5, 1), (5, 0), (4, 9), (4, 8), (4, 7), (4, 6),  \
+      (4, 5), (4, 4), (4, 3), (4, 2), (4, 1), (4, 0), (3, 9), (3, 8), (3, 7),  \
+      (3, 6), (3, 5), (3, 4), (3, 3), (3, 2), (3, 1), (3, 0), (2, 9), (2, 8),  \
+      (2, 7), (2, 6), (2, 5), (2, 4), (2, 3), (2, 2), (2, 1), (2, 0), (1, 9),  \
+      (1, 8), (1, 7), (1, 6), (1, 5), (1, 4), (1, 3), (1, 2), (1, 1), (1, 0),  \
+      (0, 9), (0, 8), (0, 7), (0, 6), (0, 5), (0, 4), (0, 3), (0, 2), (0, 1),  \
+      (0, 0)
+
+/* adds a two digit number to a 6 digit count, most significant digit first */
+#define NARG_ADD(count, ...) NARG_ADD_(__VA_ARGS__, UNPARENTHESIZE(count))
+#define NARG_ADD_(...) NARG_ADD_0(__VA_ARGS__)
+#define NARG_ADD_0(t, u, d5, d4, d3, d2, d1, d0)                               \
+  NARG_ADD_1(d5, d4, d3, d2, d1, t, DIGIT_ADD(d0, u, 0))
+#define NARG_ADD_1(...) NARG_ADD_1_(__VA_ARGS__)
+#define NARG_ADD_1_(d5, d4, d3, d2, d1, t, c, s0)                              \
+  NARG_ADD_2(d5, d4, d3, d2, DIGIT_ADD(d1, t, c), s0)
+#define NARG_ADD_2(...) NARG_ADD_2_(__VA_ARGS__)
+#define NARG_ADD_2_(d5, d4, d3, d2, c, s1, s0)                                 \
+  NARG_ADD_3(d5, d4, d3, DIGIT_ADD(d2, 0, c), s1, s0)
+#define NARG_ADD_3(...) NARG_ADD_3_(__VA_ARGS__)
+#define NARG_ADD_3_(d5, d4, d3, c, s2, s1, s0)                                 \
+  NARG_ADD_4(d5, d4, DIGIT_ADD(d3, 0, c), s2, s1, s0)
+#define NARG_ADD_4(...) NARG_ADD_4_(__VA_ARGS__)
+#define NARG_ADD_4_(d5, d4, c, s3, s2, s1, s0)                                 \
+  NARG_ADD_5(d5, DIGIT_ADD(d4, 0, c), s3, s2, s1, s0)
+#define NARG_ADD_5(...) NARG_ADD_5_(__VA_ARGS__)
+#define NARG_ADD_5_(d5, c, s4, s3, s2, s1, s0)                                 \
+  NARG_ADD_6(DIGIT_ADD(d5, 0, c), s4, s3, s2, s1, s0)
+#define NARG_ADD_6(...) NARG_ADD_6_(__VA_ARGS__)
+#define NARG_ADD_6_(c, ...) (__VA_ARGS__)
+
+#define NARG_TO_NUMBER(count) DIGITS_TO_NUMBER count
 
-#define CHECK_N(x, n, ...) n
-#define CHECK(...) CHECK_N(__VA_ARGS__, 0, )
+/* decimal digits */
 
-#define NOT(x) CHECK(PRIMITIVE_CAT(NOT_, x))
-#define NOT_0 ~, 1,
+/* expands to `carry, digit` of a + b + c, where a, b are digits, c is 0 or 1 */
+#define DIGIT_ADD(a, b, c) DIGIT_ADD_(c, a, b)
+#define DIGIT_ADD_(c, a, b) DIGIT_ADD_##c##a##b
 
-#define COMPL(b) PRIMITIVE_CAT(COMPL_, b)
-#define COMPL_0 1
-#define COMPL_1 0
+/* clang-format off */
+#define DIGIT_ADD_000 0, 0
+#define DIGIT_ADD_001 0, 1
+#define DIGIT_ADD_002 0, 2
+#define DIGIT_ADD_003 0, 3
+#define DIGIT_ADD_004 0, 4
+#define DIGIT_ADD_005 0, 5
+#define DIGIT_ADD_006 0, 6
+#define DIGIT_ADD_007 0, 7
+#define DIGIT_ADD_008 0, 8
+#define DIGIT_ADD_009 0, 9
+#define DIGIT_ADD_010 0, 1
+#define DIGIT_ADD_011 0, 2
+#define DIGIT_ADD_012 0, 3
+#define DIGIT_ADD_013 0, 4
+#define DIGIT_ADD_014 0, 5
+#define DIGIT_ADD_015 0, 6
+#define DIGIT_ADD_016 0, 7
+#define DIGIT_ADD_017 0, 8
+#define DIGIT_ADD_018 0, 9
+#define DIGIT_ADD_019 1, 0
+#define DIGIT_ADD_020 0, 2
+#define DIGIT_ADD_021 0, 3
+#define DIGIT_ADD_022 0, 4
+#define DIGIT_ADD_023 0, 5
+#define DIGIT_ADD_024 0, 6
+#define DIGIT_ADD_025 0, 7
+#define DIGIT_ADD_026 0, 8
+#define DIGIT_ADD_027 0, 9
+#define DIGIT_ADD_028 1, 0
+#define DIGIT_ADD_029 1, 1
+#define DIGIT_ADD_030 0, 3
+#define DIGIT_ADD_031 0, 4
+#define DIGIT_ADD_032 0, 5
+#define DIGIT_ADD_033 0, 6
+#define DIGIT_ADD_034 0, 7
+#define DIGIT_ADD_035 0, 8
+#define DIGIT_ADD_036 0, 9
+#define DIGIT_ADD_037 1, 0
+#define DIGIT_ADD_038 1, 1
+#define DIGIT_ADD_039 1, 2
+#define DIGIT_ADD_040 0, 4
+#define DIGIT_ADD_041 0, 5
+#define DIGIT_ADD_042 0, 6
+#define DIGIT_ADD_043 0, 7
+#define DIGIT_ADD_044 0, 8
+#define DIGIT_ADD_045 0, 9
+#define DIGIT_ADD_046 1, 0
+#define DIGIT_ADD_047 1, 1
+#define DIGIT_ADD_048 1, 2
+#define DIGIT_ADD_049 1, 3
+#define DIGIT_ADD_050 0, 5
+#define DIGIT_ADD_051 0, 6
+#define DIGIT_ADD_052 0, 7
+#define DIGIT_ADD_053 0, 8
+#define DIGIT_ADD_054 0, 9
+#define DIGIT_ADD_055 1, 0
+#define DIGIT_ADD_056 1, 1
+#define DIGIT_ADD_057 1, 2
+#define DIGIT_ADD_058 1, 3
+#define DIGIT_ADD_059 1, 4
+#define DIGIT_ADD_060 0, 6
+#define DIGIT_ADD_061 0, 7
+#define DIGIT_ADD_062 0, 8
+#define DIGIT_ADD_063 0, 9
+#define DIGIT_ADD_064 1, 0
+#define DIGIT_ADD_065 1, 1
+#define DIGIT_ADD_066 1, 2
+#define DIGIT_ADD_067 1, 3
+#define DIGIT_ADD_068 1, 4
+#define DIGIT_ADD_069 1, 5
+#define DIGIT_ADD_070 0, 7
+#define DIGIT_ADD_071 0, 8
+#define DIGIT_ADD_072 0, 9
+#define DIGIT_ADD_073 1, 0
+#define DIGIT_ADD_074 1, 1
+#define DIGIT_ADD_075 1, 2
+#define DIGIT_ADD_076 1, 3
+#define DIGIT_ADD_077 1, 4
+#define DIGIT_ADD_078 1, 5
+#define DIGIT_ADD_079 1, 6
+#define DIGIT_ADD_080 0, 8
+#define DIGIT_ADD_081 0, 9
+#define DIGIT_ADD_082 1, 0
+#define DIGIT_ADD_083 1, 1
+#define DIGIT_ADD_084 1, 2
+#define DIGIT_ADD_085 1, 3
+#define DIGIT_ADD_086 1, 4
+#define DIGIT_ADD_087 1, 5
+#define DIGIT_ADD_088 1, 6
+#define DIGIT_ADD_089 1, 7
+#define DIGIT_ADD_090 0, 9
+#define DIGIT_ADD_091 1, 0
+#define DIGIT_ADD_092 1, 1
+#define DIGIT_ADD_093 1, 2
+#define DIGIT_ADD_094 1, 3
+#define DIGIT_ADD_095 1, 4
+#define DIGIT_ADD_096 1, 5
+#define DIGIT_ADD_097 1, 6
+#define DIGIT_ADD_098 1, 7
+#define DIGIT_ADD_099 1, 8
+#define DIGIT_ADD_100 0, 1
+#define DIGIT_ADD_101 0, 2
+#define DIGIT_ADD_102 0, 3
+#define DIGIT_ADD_103 0, 4
+#define DIGIT_ADD_104 0, 5
+#define DIGIT_ADD_105 0, 6
+#define DIGIT_ADD_106 0, 7
+#define DIGIT_ADD_107 0, 8
+#define DIGIT_ADD_108 0, 9
+#define DIGIT_ADD_109 1, 0
+#define DIGIT_ADD_110 0, 2
+#define DIGIT_ADD_111 0, 3
+#define DIGIT_ADD_112 0, 4
+#define DIGIT_ADD_113 0, 5
+#define DIGIT_ADD_114 0, 6
+#define DIGIT_ADD_115 0, 7
+#define DIGIT_ADD_116 0, 8
+#define DIGIT_ADD_117 0, 9
+#define DIGIT_ADD_118 1, 0
+#define DIGIT_ADD_119 1, 1
+#define DIGIT_ADD_120 0, 3
+#define DIGIT_ADD_121 0, 4
+#define DIGIT_ADD_122 0, 5
+#define DIGIT_ADD_123 0, 6
+#define DIGIT_ADD_124 0, 7
+#define DIGIT_ADD_125 0, 8
+#define DIGIT_ADD_126 0, 9
+#define DIGIT_ADD_127 1, 0
+#define DIGIT_ADD_128 1, 1
+#define DIGIT_ADD_129 1, 2
+#define DIGIT_ADD_130 0, 4
+#define DIGIT_ADD_131 0, 5
+#define DIGIT_ADD_132 0, 6
+#define DIGIT_ADD_133 0, 7
+#define DIGIT_ADD_134 0, 8
+#define DIGIT_ADD_135 0, 9
+#define DIGIT_ADD_136 1, 0
+#define DIGIT_ADD_137 1, 1
+#define DIGIT_ADD_138 1, 2
+#define DIGIT_ADD_139 1, 3
+#define DIGIT_ADD_140 0, 5
+#define DIGIT_ADD_141 0, 6
+#define DIGIT_ADD_142 0, 7
+#define DIGIT_ADD_143 0, 8
+#define DIGIT_ADD_144 0, 9
+#define DIGIT_ADD_145 1, 0
+#define DIGIT_ADD_146 1, 1
+#define DIGIT_ADD_147 1, 2
+#define DIGIT_ADD_148 1, 3
+#define DIGIT_ADD_149 1, 4
+#define DIGIT_ADD_150 0, 6
+#define DIGIT_ADD_151 0, 7
+#define DIGIT_ADD_152 0, 8
+#define DIGIT_ADD_153 0, 9
+#define DIGIT_ADD_154 1, 0
+#define DIGIT_ADD_155 1, 1
+#define DIGIT_ADD_156 1, 2
+#define DIGIT_ADD_157 1, 3
+#define DIGIT_ADD_158 1, 4
+#define DIGIT_ADD_159 1, 5
+#define DIGIT_ADD_160 0, 7
+#define DIGIT_ADD_161 0, 8
+#define DIGIT_ADD_162 0, 9
+#define DIGIT_ADD_163 1, 0
+#define DIGIT_ADD_164 1, 1
+#define DIGIT_ADD_165 1, 2
+#define DIGIT_ADD_166 1, 3
+#define DIGIT_ADD_167 1, 4
+#define DIGIT_ADD_168 1, 5
+#define DIGIT_ADD_169 1, 6
+#define DIGIT_ADD_170 0, 8
+#define DIGIT_ADD_171 0, 9
+#define DIGIT_ADD_172 1, 0
+#define DIGIT_ADD_173 1, 1
+#define DIGIT_ADD_174 1, 2
+#define DIGIT_ADD_175 1, 3
+#define DIGIT_ADD_176 1, 4
+#define DIGIT_ADD_177 1, 5
+#define DIGIT_ADD_178 1, 6
+#define DIGIT_ADD_179 1, 7
+#define DIGIT_ADD_180 0, 9
+#define DIGIT_ADD_181 1, 0
+#define DIGIT_ADD_182 1, 1
+#define DIGIT_ADD_183 1, 2
+#define DIGIT_ADD_184 1, 3
+#define DIGIT_ADD_185 1, 4
+#define DIGIT_ADD_186 1, 5
+#define DIGIT_ADD_187 1, 6
+#define DIGIT_ADD_188 1, 7
+#define DIGIT_ADD_189 1, 8
+#define DIGIT_ADD_190 1, 0
+#define DIGIT_ADD_191 1, 1
+#define DIGIT_ADD_192 1, 2
+#define DIGIT_ADD_193 1, 3
+#define DIGIT_ADD_194 1, 4
+#define DIGIT_ADD_195 1, 5
+#define DIGIT_ADD_196 1, 6
+#define DIGIT_ADD_197 1, 7
+#define DIGIT_ADD_198 1, 8
+#define DIGIT_ADD_199 1, 9
+/* clang-format on */
 
-#define BOOL(x) COMPL(NOT(x))
+/* unary digits, counted with PP_NARG */
+/* clang-format off */
+#define DIGIT_UNARY_0
+#define DIGIT_UNARY_1 , ~
+#define DIGIT_UNARY_2 , ~, ~
+#define DIGIT_UNARY_3 , ~, ~, ~
+#define DIGIT_UNARY_4 , ~, ~, ~, ~
+#define DIGIT_UNARY_5 , ~, ~, ~, ~, ~
+#define DIGIT_UNARY_6 , ~, ~, ~, ~, ~, ~
+#define DIGIT_UNARY_7 , ~, ~, ~, ~, ~, ~, ~
+#define DIGIT_UNARY_8 , ~, ~, ~, ~, ~, ~, ~, ~
+#define DIGIT_UNARY_9 , ~, ~, ~, ~, ~, ~, ~, ~, ~
 
-#define IIF(c) PRIMITIVE_CAT(IIF_, c)
-#define IIF_0(t, ...) __VA_ARGS__
-#define IIF_1(t, ...) t
+/* DIGIT_SUM_n: `carry, digit` of n - 1 */
+#define DIGIT_SUM_1  0, 0
+#define DIGIT_SUM_2  0, 1
+#define DIGIT_SUM_3  0, 2
+#define DIGIT_SUM_4  0, 3
+#define DIGIT_SUM_5  0, 4
+#define DIGIT_SUM_6  0, 5
+#define DIGIT_SUM_7  0, 6
+#define DIGIT_SUM_8  0, 7
+#define DIGIT_SUM_9  0, 8
+#define DIGIT_SUM_10 0, 9
+#define DIGIT_SUM_11 1, 0
+#define DIGIT_SUM_12 1, 1
+#define DIGIT_SUM_13 1, 2
+#define DIGIT_SUM_14 1, 3
+#define DIGIT_SUM_15 1, 4
+#define DIGIT_SUM_16 1, 5
+#define DIGIT_SUM_17 1, 6
+#define DIGIT_SUM_18 1, 7
+#define DIGIT_SUM_19 1, 8
+#define DIGIT_SUM_20 1, 9
+/* clang-format on */
 
-#define IF(c) IIF(BOOL(c))
+/* joins digits (most significant first) into a decimal number without leading
+ * zeros, e.g. DIGITS_TO_NUMBER(0, 4, 2) expands to 42. Up to 8 digits. */
+#define DIGITS_TO_NUMBER(...)                                                  \
+  CAT(DIGITS_TO_NUMBER_, PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+#define DIGITS_TO_NUMBER_1(d) d
+#define DIGITS_TO_NUMBER_2(d, ...)                                             \
+  IIF(NOT(d))(DIGITS_TO_NUMBER_1(__VA_ARGS__), DIGITS_CAT(d, __VA_ARGS__))
+#define DIGITS_TO_NUMBER_3(d, ...)                                             \
+  IIF(NOT(d))(DIGITS_TO_NUMBER_2(__VA_ARGS__), DIGITS_CAT(d, __VA_ARGS__))
+#define DIGITS_TO_NUMBER_4(d, ...)                                             \
+  IIF(NOT(d))(DIGITS_TO_NUMBER_3(__VA_ARGS__), DIGITS_CAT(d, __VA_ARGS__))
+#define DIGITS_TO_NUMBER_5(d, ...)                                             \
+  IIF(NOT(d))(DIGITS_TO_NUMBER_4(__VA_ARGS__), DIGITS_CAT(d, __VA_ARGS__))
+#define DIGITS_TO_NUMBER_6(d, ...)                                             \
+  IIF(NOT(d))(DIGITS_TO_NUMBER_5(__VA_ARGS__), DIGITS_CAT(d, __VA_ARGS__))
+#define DIGITS_TO_NUMBER_7(d, ...)                                             \
+  IIF(NOT(d))(DIGITS_TO_NUMBER_6(__VA_ARGS__), DIGITS_CAT(d, __VA_ARGS__))
+#define DIGITS_TO_NUMBER_8(d, ...)                                             \
+  IIF(NOT(d))(DIGITS_TO_NUMBER_7(__VA_ARGS__), DIGITS_CAT(d, __VA_ARGS__))
 
-#define IS_EMPTY(...) BOOL(__VA_OPT__(0))
+#define DIGITS_CAT(...) CAT(DIGITS_CAT_, PP_NARG(__VA_ARGS__))(__VA_ARGS__)
+#define DIGITS_CAT_1(a) a
+#define DIGITS_CAT_2(a, b) a##b
+#define DIGITS_CAT_3(a, b, c) a##b##c
+#define DIGITS_CAT_4(a, b, c, d) a##b##c##d
+#define DIGITS_CAT_5(a, b, c, d, e) a##b##c##d##e
+#define DIGITS_CAT_6(a, b, c, d, e, f) a##b##c##d##e##f
+#define DIGITS_CAT_7(a, b, c, d, e, f, g) a##b##c##d##e##f##g
+#define DIGITS_CAT_8(a, b, c, d, e, f, g, h) a##b##c##d##e##f##g##h
 
+/* results are accumulated in a sequence (see cm_seq.h), which is appended to
+ * without rescanning it, and joined once at the end */
 #define CM_FOREACH_ITERATE(_prefix, _foreach, _state, _function, _head, ...)   \
-  (, IF(IS_EMPTY(__VA_ARGS__))(RETURN, FOREACH_ITERATE),                       \
-   (EXPAND _state _function(_head)), _function, __VA_ARGS__)
+  (, IF(IS_EMPTY(__VA_ARGS__))(FOREACH_DONE, FOREACH_ITERATE),                 \
+   SEQ_PUSH_BACK(_state, _function(_head)), _function, __VA_ARGS__)
+#define CM_FOREACH_DONE(p, f, state, ...) CM_RETURN(p, f, (SEQ_ELEMS(state)))
+
+#define FOREACH(f, ...) CM(FOREACH_ITERATE, SEQ_NIL, f, __VA_ARGS__)
+#define COMMA() ,
+
+/* applies `f(ctx, i, x)` to each element `x` of a list, where `i` is the
+ * decimal index of `x` starting from 0, and puts `sep()` between results (use
+ * `EMPTY` or `COMMA`). Unlike `FOREACH`, results are not accumulated in state,
+ * but emitted with `CM_EMIT`, which reverses them. Thus two machines are run:
+ * first one splits the list into chunks of 10 elements prefixed with tens of
+ * their index, and emits them, second one emits `f` applied to each chunk,
+ * which restores the order. Results are not copied, but each iteration of
+ * either machine still copies the elements or chunks left, so the cost grows
+ * quadratically with 1/10 of the list: with gcc, 1000 elements take 0.12 s,
+ * 2000 take 0.38 s. */
+#define FOREACH_I(f, ctx, sep, ...)                                            \
+  CM(FOREACH_I_APPLY, (f, ctx, sep),                                           \
+     CM(FOREACH_I_SPLIT, ((0, 0, 0, 0, 0, 0), ), __VA_ARGS__))
+
+#define CM_FOREACH_I_SPLIT(p, f, state, ...)                                   \
+  IIF(FOREACH_I_HAS_11(__VA_ARGS__))                                           \
+  (FOREACH_I_SPLIT_NEXT, FOREACH_I_SPLIT_LAST)(f, EXPAND state, __VA_ARGS__)
+
+#define FOREACH_I_SPLIT_NEXT(...) FOREACH_I_SPLIT_NEXT_(__VA_ARGS__)
+#define FOREACH_I_SPLIT_NEXT_(f, tens, tens_n, _0, _1, _2, _3, _4, _5, _6, _7, \
+                              _8, _9, ...)                                     \
+  CM_EMIT(((tens_n, _0, _1, _2, _3, _4, _5, _6, _7, _8, _9), ), , f,           \
+          FOREACH_I_NEXT_TENS(NARG_ADD(tens, 0, 1)), __VA_ARGS__)
+#define FOREACH_I_SPLIT_LAST(...) FOREACH_I_SPLIT_LAST_(__VA_ARGS__)
+#define FOREACH_I_SPLIT_LAST_(f, tens, tens_n, ...)                            \
+  CM_EMIT(((tens_n, __VA_ARGS__), ), , EXIT, CM_NO_STATE)
+
+#define FOREACH_I_NEXT_TENS(tens) (tens, NARG_TO_NUMBER(tens))
+
+/* 11th element is `NARG_MARK` unless the list has at least 11 elements */
+#define FOREACH_I_HAS_11(...)                                                  \
+  COMPL(CHECK(FOREACH_I_ARG_11_(__VA_ARGS__, NARG_MARK, NARG_MARK, NARG_MARK,  \
+                                NARG_MARK, NARG_MARK, NARG_MARK, NARG_MARK,    \
+                                NARG_MARK, NARG_MARK, NARG_MARK) ()))
+#define FOREACH_I_ARG_11_(...) FOREACH_I_ARG_11(__VA_ARGS__)
+#define FOREACH_I_ARG_11(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, x, ...) x
+
+#define CM_FOREACH_I_APPLY(p, f, state, chunk, ...)                            \
+  CM_EMIT((FOREACH_I_CHUNK(EXPAND state, EXPAND chunk)), ,                     \
+          IF(IS_EMPTY(__VA_ARGS__))(EXIT, f), state, __VA_ARGS__)
+
+#define FOREACH_I_CHUNK(...) FOREACH_I_CHUNK_(__VA_ARGS__)
+#define FOREACH_I_CHUNK_(f, ctx, sep, tens, ...)                               \
+  FOREACH_I_SEP(tens, sep)                                                     \
+  CAT(FOREACH_I_CHUNK_, PP_NARG(__VA_ARGS__))(f, ctx, sep, tens, __VA_ARGS__)
+
+/* no separator before the first element */
+#define FOREACH_I_SEP(tens, sep) IIF(IS_EMPTY(tens))(, sep())
+
+#define FOREACH_I_CHUNK_0(f, ctx, sep, tens, ...)
+#define FOREACH_I_CHUNK_1(f, ctx, sep, tens, _0) f(ctx, tens##0, _0)
+#define FOREACH_I_CHUNK_2(f, ctx, sep, tens, _0, _1)                           \
+  FOREACH_I_CHUNK_1(f, ctx, sep, tens, _0) sep() f(ctx, tens##1, _1)
+#define FOREACH_I_CHUNK_3(f, ctx, sep, tens, _0, _1, _2)                       \
+  FOREACH_I_CHUNK_2(f, ctx, sep, tens, _0, _1) sep() f(ctx, tens##2, _2)
+#define FOREACH_I_CHUNK_4(f, ctx, sep, tens, _0, _1, _2, _3)                   \
+  FOREACH_I_CHUNK_3(f, ctx, sep, tens, _0, _1, _2) sep() f(ctx, tens##3, _3)
+#define FOREACH_I_CHUNK_5(f, ctx, sep, tens, _0, _1, _2, _3, _4)               \
+  FOREACH_I_CHUNK_4(f, ctx, sep, tens, _0, _1, _2, _3)                         \
+  sep() f(ctx, tens##4, _4)
+#define FOREACH_I_CHUNK_6(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5)           \
+  FOREACH_I_CHUNK_5(f, ctx, sep, tens, _0, _1, _2, _3, _4)                     \
+  sep() f(ctx, tens##5, _5)
+#define FOREACH_I_CHUNK_7(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5, _6)       \
+  FOREACH_I_CHUNK_6(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5)                 \
+  sep() f(ctx, tens##6, _6)
+#define FOREACH_I_CHUNK_8(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5, _6, _7)   \
+  FOREACH_I_CHUNK_7(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5, _6)             \
+  sep() f(ctx, tens##7, _7)
+#define FOREACH_I_CHUNK_9(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5, _6, _7,   \
+                          _8)                                                  \
+  FOREACH_I_CHUNK_8(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5, _6, _7)         \
+  sep() f(ctx, tens##8, _8)
+#define FOREACH_I_CHUNK_10(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5, _6, _7,  \
+                           _8, _9)                                             \
+  FOREACH_I_CHUNK_9(f, ctx, sep, tens, _0, _1, _2, _3, _4, _5, _6, _7, _8)     \
+  sep() f(ctx, tens##9, _9)
+
+/* X-macro tables: applies `f(row)` to each parenthesized row of a table, like
+ * `(opcode, name, flags)`, with nothing between results. `f` picks columns
+ * with `COL(n, row)`, so one table can be expanded into switch cases, label
+ * arrays or flag masks by passing different `f`s. Every iteration applies
+ * `f` to 63 rows at once and appends results to a sequence, so the rows left
+ * are copied once per 63 rows rather than once per row, and the quadratic
+ * part of the cost stays small next to the linear one up to a few thousand
+ * rows. */
+#define FOREACH_ROWS(f, ...) CM(FOREACH_ROWS_CHUNK, SEQ_NIL, f, __VA_ARGS__)
+
+#define CM_FOREACH_ROWS_CHUNK(p, f, state, g, ...)                             \
+  IIF(NARG_HAS_64(__VA_ARGS__))                                                \
+  (FOREACH_ROWS_NEXT, FOREACH_ROWS_LAST)(f, state, g, __VA_ARGS__)
+#define FOREACH_ROWS_NEXT(f, state, g, ...)                                    \
+  (, f, state FOREACH_ROWS_63(g, __VA_ARGS__), g, NARG_DROP_63(__VA_ARGS__))
+/* missing rows are empty, and are skipped */
+#define FOREACH_ROWS_LAST(f, state, g, ...)                                    \
+  (, RETURN,                                                                   \
+   (SEQ_ELEMS(state FOREACH_ROWS_APPLY(g, __VA_ARGS__, FOREACH_ROWS_EMPTY()))))
+#define FOREACH_ROWS_APPLY(...) FOREACH_ROWS_63(__VA_ARGS__)
+#define FOREACH_ROWS_EMPTY()                                                   \
+  , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,    \
+      , , , , , , , , , , , , , , , , , , , , , , , , , ,
+#define FOREACH_ROWS_ROW(f, row) IIF(IS_EMPTY(row))(, (f(row)))
+#define FOREACH_ROWS_63(f, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12,  \
+                        _13, _14, _15, _16, _17, _18, _19, _20, _21, _22,      \
+                        _23, _24, _25, _26, _27, _28, _29, _30, _31, _32,      \
+                        _33, _34, _35, _36, _37, _38, _39, _40, _41, _42,      \
+                        _43, _44, _45, _46, _47, _48, _49, _50, _51, _52,      \
+                        _53, _54, _55, _56, _57, _58, _59, _60, _61, _62,      \
+                        _63, ...)                                              \
+  FOREACH_ROWS_ROW(f, _1) FOREACH_ROWS_ROW(f, _2) FOREACH_ROWS_ROW(f, _3)      \
+  FOREACH_ROWS_ROW(f, _4) FOREACH_ROWS_ROW(f, _5) FOREACH_ROWS_ROW(f, _6)      \
+  FOREACH_ROWS_ROW(f, _7) FOREACH_ROWS_ROW(f, _8) FOREACH_ROWS_ROW(f, _9)      \
+  FOREACH_ROWS_ROW(f, _10) FOREACH_ROWS_ROW(f, _11) FOREACH_ROWS_ROW(f, _12)   \
+  FOREACH_ROWS_ROW(f, _13) FOREACH_ROWS_ROW(f, _14) FOREACH_ROWS_ROW(f, _15)   \
+  FOREACH_ROWS_ROW(f, _16) FOREACH_ROWS_ROW(f, _17) FOREACH_ROWS_ROW(f, _18)   \
+  FOREACH_ROWS_ROW(f, _19) FOREACH_ROWS_ROW(f, _20) FOREACH_ROWS_ROW(f, _21)   \
+  FOREACH_ROWS_ROW(f, _22) FOREACH_ROWS_ROW(f, _23) FOREACH_ROWS_ROW(f, _24)   \
+  FOREACH_ROWS_ROW(f, _25) FOREACH_ROWS_ROW(f, _26) FOREACH_ROWS_ROW(f, _27)   \
+  FOREACH_ROWS_ROW(f, _28) FOREACH_ROWS_ROW(f, _29) FOREACH_ROWS_ROW(f, _30)   \
+  FOREACH_ROWS_ROW(f, _31) FOREACH_ROWS_ROW(f, _32) FOREACH_ROWS_ROW(f, _33)   \
+  FOREACH_ROWS_ROW(f, _34) FOREACH_ROWS_ROW(f, _35) FOREACH_ROWS_ROW(f, _36)   \
+  FOREACH_ROWS_ROW(f, _37) FOREACH_ROWS_ROW(f, _38) FOREACH_ROWS_ROW(f, _39)   \
+  FOREACH_ROWS_ROW(f, _40) FOREACH_ROWS_ROW(f, _41) FOREACH_ROWS_ROW(f, _42)   \
+  FOREACH_ROWS_ROW(f, _43) FOREACH_ROWS_ROW(f, _44) FOREACH_ROWS_ROW(f, _45)   \
+  FOREACH_ROWS_ROW(f, _46) FOREACH_ROWS_ROW(f, _47) FOREACH_ROWS_ROW(f, _48)   \
+  FOREACH_ROWS_ROW(f, _49) FOREACH_ROWS_ROW(f, _50) FOREACH_ROWS_ROW(f, _51)   \
+  FOREACH_ROWS_ROW(f, _52) FOREACH_ROWS_ROW(f, _53) FOREACH_ROWS_ROW(f, _54)   \
+  FOREACH_ROWS_ROW(f, _55) FOREACH_ROWS_ROW(f, _56) FOREACH_ROWS_ROW(f, _57)   \
+  FOREACH_ROWS_ROW(f, _58) FOREACH_ROWS_ROW(f, _59) FOREACH_ROWS_ROW(f, _60)   \
+  FOREACH_ROWS_ROW(f, _61) FOREACH_ROWS_ROW(f, _62) FOREACH_ROWS_ROW(f, _63)
 
-#define FOREACH(f, ...) CM(FOREACH_ITERATE, CM_NO_STATE, f, __VA_ARGS__)
\ No newline at end of file
+/* `n`-th column (from 0, up to 15) of a parenthesized row */
+#define COL(n, row) COL_(PRIMITIVE_CAT(COL_, n), UNPARENTHESIZE(row))
+#define COL_(col, ...) col(__VA_ARGS__, )
+#define COL_0(...) FIRST_ARG(__VA_ARGS__)
+#define COL_1(x, ...) COL_0(__VA_ARGS__)
+#define COL_2(x, ...) COL_1(__VA_ARGS__)
+#define COL_3(x, ...) COL_2(__VA_ARGS__)
+#define COL_4(x, ...) COL_3(__VA_ARGS__)
+#define COL_5(x, ...) COL_4(__VA_ARGS__)
+#define COL_6(x, ...) COL_5(__VA_ARGS__)
+#define COL_7(x, ...) COL_6(__VA_ARGS__)
+#define COL_8(x, ...) COL_7(__VA_ARGS__)
+#define COL_9(x, ...) COL_8(__VA_ARGS__)
+#define COL_10(x, ...) COL_9(__VA_ARGS__)
+#define COL_11(x, ...) COL_10(__VA_ARGS__)
+#define COL_12(x, ...) COL_11(__VA_ARGS__)
+#define COL_13(x, ...) COL_12(__VA_ARGS__)
+#define COL_14(x, ...) COL_13(__VA_ARGS__)
+#define COL_15(x, ...) COL_14(__VA_ARGS__)
@@ -0,0 +1,44 @@
+/**
+ * @file macro_primitives.h
+ * @brief Expansion, concatenation and conditionals that everything builds on.
+ *
+ * These macros use neither `CM` nor sequences, so `cm_seq.h` and
+ * `macro_helpers.h` can both include this header without including each
+ * other.
+ */
+#pragma once
+
+#define DISCARD(...)
+
+#define PARENTHESIZE(...) (__VA_ARGS__)
+
+/* removes parentheses from passed argument */
+#define EXPAND(...) __VA_ARGS__
+#define EMPTY()
+#define DEFER(...) __VA_ARGS__ EMPTY()
+#define UNPARENTHESIZE(arg) EXPAND arg
+
+#define FIRST_ARG(arg, ...) arg
+
+#define CAT(a, ...) PRIMITIVE_CAT(a, __VA_ARGS__)
+#define PRIMITIVE_CAT(a, ...) a##__VA_ARGS__
+
+#define CHECK_N(x, n, ...) n
+#define CHECK(...) CHECK_N(__VA_ARGS__, 0, )
+
+#define NOT(x) CHECK(PRIMITIVE_CAT(NOT_, x))
+#define NOT_0 ~, 1,
+
+#define COMPL(b) PRIMITIVE_CAT(COMPL_, b)
+#define COMPL_0 1
+#define COMPL_1 0
+
+#define BOOL(x) COMPL(NOT(x))
+
+#define IIF(c) PRIMITIVE_CAT(IIF_, c)
+#define IIF_0(t, ...) __VA_ARGS__
+#define IIF_1(t, ...) t
+
+#define IF(c) IIF(BOOL(c))
+
+#define IS_EMPTY(...) BOOL(__VA_OPT__(0))
@@ -0,0 +1,439 @@
+#!/usr/bin/env python3
+"""Compiler wrapper that caches expansions of top-level CM calls.
+
+Usage:
+    tools/cm-cache.py gcc -c foo.c -o foo.o [flags]
+    tools/cm-cache.py -m CM FOREACH MY_MAP -- gcc -c foo.c -o foo.o
+    tools/cm-cache.py --stats -- gcc -c foo.c  # hits and misses on stderr
+    tools/cm-cache.py --clear
+
+For a single source compiled with -c, the wrapper:
+1. Finds top-level calls of the cached macros (`CM`, `FOREACH`, `FOREACH_I`
+   by default), i.e. calls outside of directives, comments, literals and
+   other parentheses.
+2. Preprocesses the source once with every such call replaced by a marker
+   followed by its arguments, which is cheap, as no machine runs. The key of
+   a call is a hash of the macro name, its expanded arguments and every macro
+   definition in effect at the call, so any change to a transition function,
+   a helper or a ladder invalidates it.
+3. Preprocesses the source again with the calls found in the cache replaced
+   by placeholders, and only the others left in place. Their expansions are
+   stored, and the placeholders are replaced by the cached ones.
+4. Compiles the result with the original command.
+
+Everything else (linking, several sources, -E) is passed to the compiler
+unchanged. Set CM_CACHE_DIR to move the cache from ~/.cache/cm-cache.
+
+Only calls written in the source itself are cached. Those in included
+headers, e.g. a shared header that every translation unit includes, are
+expanded by the compiler as usual; --stats reports 0 call sites for a source
+that has none of its own.
+
+Calls whose expansion depends on `__LINE__`, `__COUNTER__` or similar inside
+transition functions are cached with the value they had when stored. Calls
+that expand to `_Pragma` are not cached.
+"""
+import argparse
+import hashlib
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+VERSION = "1"
+
+MACROS = ("CM", "FOREACH", "FOREACH_I")
+
+C_SOURCES = (".c",)
+CXX_SOURCES = (".cc", ".cp", ".cxx", ".cpp", ".CPP", ".c++", ".C")
+
+# Options whose value is a separate argument.
+WITH_VALUE = {"-o", "-I", "-D", "-U", "-include", "-imacros", "-isystem",
+              "-iquote", "-idirafter", "-x", "-MF", "-MT", "-MQ", "-Xclang",
+              "-Xpreprocessor", "-Xlinker"}
+# Options that only matter when preprocessing.
+DEPENDENCY = {"-M", "-MM", "-MD", "-MMD", "-MG", "-MP"}
+DEPENDENCY_WITH_VALUE = {"-MF", "-MT", "-MQ"}
+PREPROCESS_ONLY_WITH_VALUE = {"-include", "-imacros"}
+
+# C preprocessing tokens, as in bench/run_bench.py.
+TOKEN = re.compile(r'"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\'|[A-Za-z_]\w*|'
+                   r'\.?\d(?:[eEpP][+-]|[\w.])*|\S')
+LINEMARKER = re.compile(r"^#(?: \d+| line).*$", re.MULTILINE)
+SITE = "__cm_cache_site_"
+HIT = "__cm_cache_hit_"
+BEGIN = "__cm_cache_begin_"
+END = "__cm_cache_end_"
+
+
+def cache_dir():
+    return os.environ.get("CM_CACHE_DIR") or os.path.join(
+        os.path.expanduser("~"), ".cache", "cm-cache")
+
+
+def cache_path(key):
+    return os.path.join(cache_dir(), key[:2], key)
+
+
+def load(key):
+    try:
+        with open(cache_path(key)) as f:
+            return f.read()
+    except OSError:
+        return None
+
+
+def store(key, text):
+    path = cache_path(key)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    fd, tmp = tempfile.mkstemp(dir=os.path.dirname(path))
+    with os.fdopen(fd, "w") as f:
+        f.write(text)
+    os.replace(tmp, path)
+
+
+def skip_literal(text, i):
+    """Index past the string or character literal starting at text[i]."""
+    quote = text[i]
+    i += 1
+    while i < len(text) and text[i] != quote and text[i] != "\n":
+        i += 2 if text[i] == "\\" else 1
+    return i + 1
+
+
+def skip_comment(text, i):
+    """Index past the block comment starting at text[i]."""
+    end = text.find("*/", i + 2)
+    return len(text) if end < 0 else end + 2
+
+
+def find_calls(text, macros):
+    """(start, end, name) of every top-level call of `macros` in `text`.
+
+    `end` is past the closing parenthesis. Directives, comments, literals and
+    calls nested in other parentheses are skipped.
+    """
+    calls = []
+    depth = 0
+    line_start = True
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c == "\n":
+            line_start = True
+            i += 1
+        elif c in " \t\r\f\v":
+            i += 1
+        elif c == "#" and line_start:
+            # skip the directive, with its continuation lines
+            while i < len(text) and text[i] != "\n":
+                if text.startswith("/*", i):
+                    i = skip_comment(text, i)
+                else:
+                    i += 2 if text[i] == "\\" else 1
+        elif text.startswith("//", i):
+            i = text.find("\n", i)
+            i = len(text) if i < 0 else i
+        elif text.startswith("/*", i):
+            i = skip_comment(text, i)
+        else:
+            line_start = False
+            m = TOKEN.match(text, i)
+            token = m.group(0)
+            if token[0] in "\"'":
+                i = skip_literal(text, i)
+                continue
+            i = m.end()
+            if token == "(":
+                depth += 1
+            elif token == ")":
+                depth = max(depth - 1, 0)
+            elif depth == 0 and token in macros:
+                j = i
+                while j < len(text) and text[j].isspace():
+                    j += 1
+                if j < len(text) and text[j] == "(":
+                    end = match_paren(text, j)
+                    if end is not None:
+                        calls.append((m.start(), end, token))
+                        i = end
+    return calls
+
+
+def match_paren(text, i):
+    """Index past the parenthesis matching text[i], skipping literals."""
+    depth = 0
+    while i < len(text):
+        c = text[i]
+        if c in "\"'":
+            i = skip_literal(text, i)
+            continue
+        if text.startswith("//", i):
+            i = text.find("\n", i)
+            if i < 0:
+                return None
+            continue
+        if text.startswith("/*", i):
+            i = text.find("*/", i + 2)
+            if i < 0:
+                return None
+            i += 2
+            continue
+        if c == "(":
+            depth += 1
+        elif c == ")":
+            depth -= 1
+            if depth == 0:
+                return i + 1
+        i += 1
+    return None
+
+
+def normalize(text):
+    """Tokens of preprocessed `text`, on one line."""
+    return " ".join(TOKEN.findall(LINEMARKER.sub("", text)))
+
+
+def rewrite(text, calls, replace):
+    """`text` with calls[i] replaced by replace(i, call text).
+
+    Newlines of a replaced call are kept, so that line numbers do not change.
+    """
+    out = []
+    last = 0
+    for i, (start, end, name) in enumerate(calls):
+        call = text[start:end]
+        replacement = replace(i, name, call)
+        out.append(text[last:start])
+        out.append(replacement + "\n" * (call.count("\n") -
+                                         replacement.count("\n")))
+        last = end
+    out.append(text[last:])
+    return "".join(out)
+
+
+def keys(preprocessed, calls, compiler):
+    """Cache key of every call, from the output of the first pass."""
+    result = [None] * len(calls)
+    definitions = hashlib.sha256((VERSION + "\0" + compiler).encode())
+    pattern = re.compile(r"^#(?:define|undef)\s.*$|\b%s(\d+)\b" % SITE,
+                         re.MULTILINE)
+    pos = 0
+    while True:
+        m = pattern.search(preprocessed, pos)
+        if m is None:
+            return result
+        pos = m.end()
+        if m.group(1) is None:
+            definitions.update(m.group(0).encode() + b"\n")
+            continue
+        i = int(m.group(1))
+        start = preprocessed.find("(", pos)
+        end = match_paren(preprocessed, start)
+        if i >= len(calls) or end is None:
+            continue
+        key = definitions.copy()
+        key.update(("\0%s\0%s" % (calls[i][2], normalize(
+            preprocessed[start:end]))).encode())
+        result[i] = key.hexdigest()
+        pos = end
+
+
+def parse_command(command):
+    """(source, language, preprocess flags, compile flags) of a compiler
+    command, or None if it shall be passed through."""
+    sources = []
+    language = None
+    preprocess = []
+    compile_flags = []
+    has_c = False
+    i = 1
+    while i < len(command):
+        a = command[i]
+        value = [command[i + 1]] if a in WITH_VALUE and \
+            i + 1 < len(command) else []
+        if a in ("-E", "-S", "-M", "-MM") or a.startswith("-save-temps"):
+            return None
+        if a == "-c":
+            has_c = True
+            compile_flags.append(a)
+        elif a == "-x":
+            language = value[0] if value else None
+        elif not a.startswith("-") and a.endswith(C_SOURCES + CXX_SOURCES):
+            sources.append(a)
+        elif a in DEPENDENCY or a in DEPENDENCY_WITH_VALUE:
+            preprocess += [a] + value
+        elif a in PREPROCESS_ONLY_WITH_VALUE:
+            preprocess += [a] + value
+        elif a == "-o":
+            compile_flags += [a] + value
+        else:
+            preprocess += [a] + value
+            compile_flags += [a] + value
+        i += 1 + len(value)
+    if not has_c or len(sources) != 1:
+        return None
+    source = sources[0]
+    if language is None:
+        language = "c++" if source.endswith(CXX_SOURCES) else "c"
+    return source, language, preprocess, compile_flags
+
+
+def preprocess(compiler, flags, language, source, path, extra=()):
+    cmd = [compiler, "-E", "-x", language, "-iquote",
+           os.path.dirname(os.path.abspath(source)) or "."] + \
+        [f for f in flags if f not in DEPENDENCY] + list(extra) + [path]
+    # drop the values of dependency options
+    for opt in DEPENDENCY_WITH_VALUE:
+        while opt in cmd:
+            i = cmd.index(opt)
+            del cmd[i:i + 2]
+    return subprocess.run(cmd, check=True, capture_output=True,
+                          text=True).stdout
+
+
+def quote(path):
+    """`path` as a string literal of a line marker."""
+    return '"%s"' % path.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def relocate(preprocessed, path, source):
+    """Points line markers of the copy at `path` to the original source, so
+    that the object file and its debug information name the source as a
+    direct build would."""
+    return re.sub(r"^(#(?: \d+| line \d+) )%s" % re.escape(quote(path)),
+                  lambda m: m.group(1) + quote(source), preprocessed,
+                  flags=re.MULTILINE)
+
+
+def object_file(compile_flags, source):
+    if "-o" in compile_flags:
+        return compile_flags[compile_flags.index("-o") + 1]
+    return os.path.splitext(os.path.basename(source))[0] + ".o"
+
+
+def dependency_file(flags, compile_flags, source):
+    if "-MF" in flags:
+        return flags[flags.index("-MF") + 1]
+    return os.path.splitext(object_file(compile_flags, source))[0] + ".d"
+
+
+def run(command, macros, stats):
+    parsed = parse_command(command)
+    if parsed is None:
+        return subprocess.call(command)
+    source, language, flags, compile_flags = parsed
+    compiler = command[0]
+    with open(source) as f:
+        text = f.read()
+    calls = find_calls(text, set(macros))
+    if not calls:
+        if stats:
+            print("cm-cache: %s: 0 call sites" % source, file=sys.stderr)
+        return subprocess.call(command)
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        path = os.path.join(tmpdir, "source" + os.path.splitext(source)[1])
+        header = "#line 1 %s\n" % quote(source)
+
+        # first pass: expanded arguments and definitions in effect
+        with open(path, "w") as f:
+            f.write(header + rewrite(text, calls, lambda i, name, call:
+                                     "%s%d %s" % (SITE, i,
+                                                  call[len(name):])))
+        try:
+            call_keys = keys(preprocess(compiler, flags, language, source,
+                                        path, ["-dD"]), calls, compiler)
+        except subprocess.CalledProcessError:
+            return subprocess.call(command)
+        cached = [load(k) if k else None for k in call_keys]
+
+        # second pass: only the calls not found in the cache are expanded
+        with open(path, "w") as f:
+            f.write(header + rewrite(
+                text, calls, lambda i, name, call:
+                "%s%d" % (HIT, i) if cached[i] is not None else
+                "%s%d %s %s%d" % (BEGIN, i, call, END, i)))
+        cmd = [compiler, "-E", "-x", language, "-iquote",
+               os.path.dirname(os.path.abspath(source)) or "."] + flags + \
+            [path]
+        dependencies = any(f in DEPENDENCY for f in flags)
+        if dependencies:
+            # as the compiler would name them for the original command
+            if "-MF" not in flags:
+                cmd += ["-MF", dependency_file(flags, compile_flags, source)]
+            if "-MT" not in flags and "-MQ" not in flags:
+                cmd += ["-MT", object_file(compile_flags, source)]
+        result = subprocess.run(cmd, capture_output=True, text=True)
+        sys.stderr.write(result.stderr)
+        if result.returncode != 0:
+            return result.returncode
+        preprocessed = relocate(result.stdout, path, source)
+
+        misses = 0
+        for i, k in enumerate(call_keys):
+            if cached[i] is not None:
+                preprocessed = re.sub(r"\b%s%d\b" % (HIT, i),
+                                      lambda m: cached[i], preprocessed)
+                continue
+            m = re.search(r"\b%s%d\b(.*?)\b%s%d\b" % (BEGIN, i, END, i),
+                          preprocessed, re.DOTALL)
+            if m is None:
+                continue
+            misses += 1
+            expansion = m.group(1)
+            if k is not None and not re.search(r"^\s*#\s*pragma\b",
+                                               expansion, re.MULTILINE):
+                store(k, normalize(expansion))
+            preprocessed = preprocessed[:m.start()] + expansion + \
+                preprocessed[m.end():]
+        if stats:
+            hits = sum(c is not None for c in cached)
+            print("cm-cache: %s: %d hits, %d misses" % (source, hits, misses),
+                  file=sys.stderr)
+
+        if dependencies:
+            dep = dependency_file(flags, compile_flags, source)
+            if os.path.exists(dep):
+                with open(dep) as f:
+                    deps = f.read()
+                with open(dep, "w") as f:
+                    f.write(deps.replace(path, source))
+
+        output = os.path.join(tmpdir, "source" +
+                              (".ii" if language == "c++" else ".i"))
+        with open(output, "w") as f:
+            f.write(preprocessed)
+        return subprocess.call(
+            [compiler] + compile_flags +
+            ["-x", language + "-cpp-output" if language == "c++"
+             else "cpp-output", output])
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        usage="%(prog)s [-m MACRO ...] [--stats] [--] compiler args...")
+    parser.add_argument("-m", "--macro", nargs="+", default=list(MACROS),
+                        help="macros whose top-level calls are cached "
+                        "(default: %s)" % " ".join(MACROS))
+    parser.add_argument("--stats", action="store_true",
+                        help="print hits and misses to stderr")
+    parser.add_argument("--clear", action="store_true",
+                        help="remove every cached expansion")
+    parser.add_argument("command", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+
+    if args.clear:
+        shutil.rmtree(cache_dir(), ignore_errors=True)
+        return 0
+    command = args.command[1:] if args.command[:1] == ["--"] else args.command
+    if not command:
+        parser.error("no compiler command")
+    return run(command, args.macro, args.stats)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
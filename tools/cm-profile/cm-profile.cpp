@@ -0,0 +1,348 @@
+/**
+ * @file cm-profile.cpp
+ * @brief Expansion profiler for continuation machine macros.
+ *
+ * Preprocesses a translation unit with Boost.Wave and, through its
+ * preprocessing hooks, reports:
+ * - invocation count of every `CM_` macro,
+ * - number of `CM_EXEC_N` expansions and tokens rescanned by them, per level,
+ * - peak length of a token list produced by a single macro expansion,
+ * - time spent inside each transition function, i.e. every macro that a
+ * dispatcher of the machine (`CM_EXEC_N`, `CM_CONT_N`, `CM_UNROLL_N`, ...)
+ * invoked as `CM_##f`, with `f` taken from the dispatcher's arguments.
+ *
+ * Usage:
+ * @code
+ * cm-profile [-I dir]... [-S dir]... [-D name[=value]]... [-U name]...
+ *            [-o output] [-a] [-n count] file
+ * @endcode
+ *
+ * - `-a`: report all macros, not only `CM_` ones.
+ * - `-n`: number of rows in each table (default 20).
+ * - `-o`: write preprocessed output to a file (discarded by default).
+ *
+ * Time of a macro is measured from the moment its invocation is recognized
+ * until the rescan of its replacement list is complete, so it includes
+ * argument prescan. Self time excludes macros invoked in the meantime. When a
+ * macro is invoked within its own expansion (e.g. in an argument), only the
+ * outermost invocation contributes to its total time.
+ */
+#include <boost/wave.hpp>
+#include <boost/wave/cpplexer/cpp_lex_iterator.hpp>
+#include <boost/wave/cpplexer/cpp_lex_token.hpp>
+#include <boost/wave/preprocessing_hooks.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct macro_stats {
+  std::size_t calls = 0;
+  std::size_t active = 0; /* invocations currently on the stack */
+  clock_type::duration total{};
+  clock_type::duration self{};
+};
+
+struct level_stats {
+  std::size_t calls = 0;
+  std::size_t rescanned_tokens = 0;
+};
+
+struct frame {
+  std::string name;
+  clock_type::time_point start;
+  clock_type::duration children{};
+};
+
+bool starts_with(std::string const &s, char const *prefix) {
+  return s.compare(0, std::strlen(prefix), prefix) == 0;
+}
+
+/* `N` for `CM_EXEC_N`, -1 otherwise */
+int exec_level(std::string const &name) {
+  static char const prefix[] = "CM_EXEC_";
+  if (!starts_with(name, prefix) || name.size() == sizeof(prefix) - 1)
+    return -1;
+  for (std::size_t i = sizeof(prefix) - 1; i < name.size(); ++i)
+    if (name[i] < '0' || name[i] > '9')
+      return -1;
+  return std::atoi(name.c_str() + sizeof(prefix) - 1);
+}
+
+bool is_numbered(std::string const &name, char const *prefix) {
+  if (!starts_with(name, prefix) || name.size() == std::strlen(prefix))
+    return false;
+  return name.find_first_not_of("0123456789", std::strlen(prefix)) ==
+         std::string::npos;
+}
+
+/* index of the argument `f` of a macro that invokes `CM_##f`, -1 otherwise */
+int dispatched_arg(std::string const &name) {
+  if (is_numbered(name, "CM_EXEC_") || is_numbered(name, "CM_CONT_") ||
+      name == "CM_UNROLL_APPLY" || name == "CM_STATS_CALL_")
+    return 1;
+  if (is_numbered(name, "CM_UNROLL_"))
+    return 2;
+  return -1;
+}
+
+class profiling_hooks
+    : public boost::wave::context_policies::default_preprocessing_hooks {
+public:
+  std::map<std::string, macro_stats> macros;
+  std::map<int, level_stats> levels;
+  std::set<std::string> transitions;
+  std::size_t peak_tokens = 0;
+  std::string peak_macro;
+
+  template <typename ContextT, typename TokenT, typename ContainerT,
+            typename IteratorT>
+  bool expanding_function_like_macro(
+      ContextT const &, TokenT const &macrodef, std::vector<TokenT> const &,
+      ContainerT const &, TokenT const &,
+      std::vector<ContainerT> const &arguments, IteratorT const &,
+      IteratorT const &) {
+    std::string name = macrodef.get_value().c_str();
+    int arg = dispatched_arg(name);
+    if (arg >= 0 && std::size_t(arg) < arguments.size())
+      transitions.insert("CM_" + spelling(arguments[arg]));
+    /* __VA_OPT__ is reported as a macro, but never rescanned */
+    if (name != "__VA_OPT__")
+      enter(name);
+    return false;
+  }
+
+  template <typename ContextT, typename TokenT, typename ContainerT>
+  bool expanding_object_like_macro(ContextT const &, TokenT const &macro,
+                                   ContainerT const &, TokenT const &) {
+    enter(macro.get_value().c_str());
+    return false;
+  }
+
+  template <typename ContextT, typename ContainerT>
+  void expanded_macro(ContextT const &, ContainerT const &result) {
+    if (stack_.empty())
+      return;
+    std::size_t size = std::distance(result.begin(), result.end());
+    int level = exec_level(stack_.back().name);
+    if (level >= 0)
+      levels[level].rescanned_tokens += size;
+    peak(size);
+  }
+
+  template <typename ContextT, typename ContainerT>
+  void rescanned_macro(ContextT const &, ContainerT const &result) {
+    if (stack_.empty())
+      return;
+    peak(std::distance(result.begin(), result.end()));
+
+    frame f = stack_.back();
+    stack_.pop_back();
+    clock_type::duration elapsed = clock_type::now() - f.start;
+    macro_stats &stats = macros[f.name];
+    if (--stats.active == 0)
+      stats.total += elapsed;
+    stats.self += elapsed - f.children;
+    if (!stack_.empty())
+      stack_.back().children += elapsed;
+  }
+
+private:
+  std::vector<frame> stack_;
+
+  void enter(std::string const &name) {
+    macro_stats &stats = macros[name];
+    ++stats.calls;
+    ++stats.active;
+    int level = exec_level(name);
+    if (level >= 0)
+      ++levels[level].calls;
+    stack_.push_back(frame{name, clock_type::now()});
+  }
+
+  template <typename ContainerT>
+  static std::string spelling(ContainerT const &tokens) {
+    std::string s;
+    for (auto const &t : tokens)
+      if (!IS_CATEGORY(boost::wave::token_id(t),
+                       boost::wave::WhiteSpaceTokenType))
+        s += t.get_value().c_str();
+    return s;
+  }
+
+  void peak(std::size_t size) {
+    if (size > peak_tokens) {
+      peak_tokens = size;
+      peak_macro = stack_.back().name;
+    }
+  }
+};
+
+double ms(clock_type::duration d) {
+  return std::chrono::duration<double, std::milli>(d).count();
+}
+
+using row = std::pair<std::string, macro_stats>;
+
+void print_table(char const *title, std::vector<row> rows, std::size_t limit) {
+  std::sort(rows.begin(), rows.end(), [](row const &a, row const &b) {
+    return a.second.total > b.second.total;
+  });
+  std::printf("\n%s\n", title);
+  std::printf("%-40s %10s %12s %12s\n", "macro", "calls", "total ms",
+              "self ms");
+  for (std::size_t i = 0; i < rows.size() && i < limit; ++i)
+    std::printf("%-40s %10zu %12.3f %12.3f\n", rows[i].first.c_str(),
+                rows[i].second.calls, ms(rows[i].second.total),
+                ms(rows[i].second.self));
+  if (rows.size() > limit)
+    std::printf("(%zu more)\n", rows.size() - limit);
+}
+
+void usage() {
+  std::fprintf(stderr,
+               "usage: cm-profile [-I dir]... [-S dir]... [-D name[=value]]..."
+               " [-U name]...\n"
+               "                  [-o output] [-a] [-n count] file\n");
+  std::exit(2);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  std::vector<std::string> includes, sysincludes, defines, undefines;
+  std::string input, output;
+  bool all = false;
+  std::size_t limit = 20;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "-a") {
+      all = true;
+      continue;
+    }
+    if (arg.size() < 2 || arg[0] != '-') {
+      if (!input.empty())
+        usage();
+      input = arg;
+      continue;
+    }
+    /* both `-Ifoo` and `-I foo` */
+    std::string value = arg.substr(2);
+    if (value.empty()) {
+      if (++i == argc)
+        usage();
+      value = argv[i];
+    }
+    switch (arg[1]) {
+    case 'I': includes.push_back(value); break;
+    case 'S': sysincludes.push_back(value); break;
+    case 'D': defines.push_back(value); break;
+    case 'U': undefines.push_back(value); break;
+    case 'o': output = value; break;
+    case 'n': limit = std::strtoul(value.c_str(), nullptr, 10); break;
+    default: usage();
+    }
+  }
+  if (input.empty())
+    usage();
+
+  std::ifstream in(input);
+  if (!in) {
+    std::fprintf(stderr, "cm-profile: cannot open %s\n", input.c_str());
+    return 1;
+  }
+  std::string source((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+
+  using token_type = boost::wave::cpplexer::lex_token<>;
+  using lex_iterator_type = boost::wave::cpplexer::lex_iterator<token_type>;
+  using context_type = boost::wave::context<
+      std::string::iterator, lex_iterator_type,
+      boost::wave::iteration_context_policies::load_file_to_string,
+      profiling_hooks>;
+
+  context_type ctx(source.begin(), source.end(), input.c_str());
+  ctx.set_language(boost::wave::language_support(
+      boost::wave::support_cpp2a | boost::wave::support_option_va_opt |
+      boost::wave::support_option_emit_line_directives));
+  ctx.set_max_include_nesting_depth(1024);
+  for (std::string const &dir : includes)
+    ctx.add_include_path(dir.c_str());
+  for (std::string const &dir : sysincludes)
+    ctx.add_sysinclude_path(dir.c_str());
+  for (std::string const &def : defines)
+    ctx.add_macro_definition(def);
+  for (std::string const &name : undefines)
+    ctx.remove_macro_definition(name);
+
+  std::ofstream out;
+  if (!output.empty())
+    out.open(output);
+
+  std::size_t out_tokens = 0;
+  clock_type::time_point start = clock_type::now();
+  try {
+    for (context_type::iterator_type it = ctx.begin(), end = ctx.end();
+         it != end; ++it) {
+      boost::wave::token_id id = boost::wave::token_id(*it);
+      if (!IS_CATEGORY(id, boost::wave::WhiteSpaceTokenType) &&
+          !IS_CATEGORY(id, boost::wave::EOLTokenType) &&
+          !IS_CATEGORY(id, boost::wave::EOFTokenType))
+        ++out_tokens;
+      if (out)
+        out << it->get_value();
+    }
+  } catch (boost::wave::cpp_exception const &e) {
+    std::fprintf(stderr, "%s:%zu:%zu: error: %s\n", e.file_name(),
+                 e.line_no(), e.column_no(), e.description());
+    return 1;
+  } catch (std::exception const &e) {
+    std::fprintf(stderr, "cm-profile: %s\n", e.what());
+    return 1;
+  }
+  clock_type::duration elapsed = clock_type::now() - start;
+  profiling_hooks const &hooks = ctx.get_hooks();
+
+  std::vector<row> cm, transitions, other;
+  for (auto const &m : hooks.macros) {
+    if (starts_with(m.first, "CM_")) {
+      cm.push_back(m);
+      if (hooks.transitions.count(m.first))
+        transitions.push_back(m);
+    } else if (all) {
+      other.push_back(m);
+    }
+  }
+
+  std::printf("file: %s\n", input.c_str());
+  std::printf("time: %.3f ms\n", ms(elapsed));
+  std::printf("output tokens: %zu\n", out_tokens);
+  std::printf("peak token list: %zu (%s)\n", hooks.peak_tokens,
+              hooks.peak_macro.c_str());
+
+  std::printf("\n%-10s %10s %16s\n", "level", "calls", "rescanned tokens");
+  for (auto const &l : hooks.levels)
+    std::printf("CM_EXEC_%-2d %10zu %16zu\n", l.first, l.second.calls,
+                l.second.rescanned_tokens);
+
+  print_table("transitions", transitions, limit);
+  print_table("CM_ macros", cm, limit);
+  if (all)
+    print_table("other macros", other, limit);
+  return 0;
+}
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""Generates the CM_EXEC_N/CM_CONT_N ladder headers for continuation_machine.h.
+
+Usage:
+    tools/gen_ladder.py 12 > ladder/cm_ladder_12.h
+    tools/gen_ladder.py 7 -b 3 > my_ladder.h   # 3x growth per level
+    tools/gen_ladder.py --preset x4            # writes ladder/cm_ladder_x4_6.h
+    tools/gen_ladder.py --list                 # presets and their ceilings
+    tools/gen_ladder.py --all  # regenerates every checked-in ladder
+
+A ladder has three parameters:
+- level L: highest CM_EXEC_N/CM_CONT_N.
+- branching factor b: CM_EXEC_N applies CM_EXEC_(N-1) b times, so it applies
+  the transition (b^(N+1) - 1) / (b - 1) times.
+- step s: CM_CONT_N hands over to CM_CONT_(N+s). With s = 0 there is no ramp,
+  CM_CONT_0 goes straight to CM_EXEC_L.
+
+A ladder of level L with b = 2, s = 1 lets the machine run for at most
+2^(L + 2) - 2 iterations. Only the ladder selected by CM_MAX_LEVEL (or
+CM_LADDER_HEADER) is ever included, so deeper ladders cost nothing unless they
+are asked for.
+"""
+import argparse
+import os
+import sys
+
+# Levels checked into ladder/. Keep in sync with continuation_machine.h.
+LEVELS = (9, 12, 14, 16)
+
+# Presets checked into ladder/: name -> (level, branching factor, step).
+# Each is meant to be selected with CM_LADDER_HEADER, see preset_header().
+PRESETS = {
+    "x2": (9, 2, 1),
+    "x2_skip": (9, 2, 2),
+    "x2_flat": (9, 2, 0),
+    "x3": (7, 3, 1),
+    "x4": (6, 4, 1),
+}
+
+LADDER_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir,
+                          "ladder")
+
+
+def exec_iterations(n, branch):
+    """Number of transitions applied by CM_EXEC_N."""
+    return (branch ** (n + 1) - 1) // (branch - 1)
+
+
+def cont_levels(level, step):
+    """Levels of CM_CONT_N the machine goes through, starting from CM_CONT_0."""
+    if step == 0:
+        return [0]
+    levels = list(range(0, level + 1, step))
+    if levels[-1] != level:
+        levels.append(level)
+    return levels
+
+
+def max_iterations(level, branch=2, step=1):
+    # CM_CONT_N applies the transition once and then runs CM_EXEC_N. With no
+    # ramp, CM_CONT_0 runs CM_EXEC_L instead.
+    if step == 0:
+        return 1 + exec_iterations(level, branch)
+    return sum(1 + exec_iterations(n, branch)
+               for n in cont_levels(level, step))
+
+
+def header_name(level, branch=2, step=1):
+    name = "cm_ladder_%d" % level
+    if branch != 2:
+        name = "cm_ladder_x%d_%d" % (branch, level)
+    if step != 1:
+        name += "_s%d" % step
+    return name + ".h"
+
+
+def generate(level, branch=2, step=1):
+    call = "CM_##f(, p##f, p##__VA_ARGS__)"
+    # Names are never padded: a space before `(` would turn a function-like
+    # macro into an object-like one. Alignment goes after the parameter list.
+    out = []
+    out.append("/**")
+    out.append(" * @file " + header_name(level, branch, step))
+    out.append(" * @brief Level %d ladder for continuation_machine.h (at most %d "
+               "iterations)." % (level, max_iterations(level, branch, step)))
+    out.append(" *")
+    if branch != 2 or step != 1:
+        out.append(" * Branching factor %d, CM_CONT_N step %d." % (branch, step))
+        out.append(" *")
+    out.append(" * Generated by tools/gen_ladder.py. Do not edit.")
+    out.append(" */")
+    out.append("#pragma once")
+    out.append("")
+    out.append("/* clang-format off */")
+
+    # Invocations of `f` are right-aligned across the whole CM_EXEC_N table.
+    width = len("CM_EXECUTE_%d(" % (level - 1)) * branch
+    head0 = "#define CM_EXEC_%d(p, f, ...) " % level
+    for n in range(0, level + 1):
+        head = ("#define CM_EXEC_%d(p, f, ...) " % n).ljust(len(head0))
+        if n == 0:
+            out.append(head + " " * width + call)
+            continue
+        inner = ("CM_EXECUTE_%d(" % (n - 1)) * branch
+        out.append(head + inner.rjust(width) + call + ")" * branch)
+    out.append("")
+
+    conts = cont_levels(level, step)
+    for i, n in enumerate(conts):
+        if i + 1 < len(conts):
+            nxt = "CM_CONTINUE_%d(" % conts[i + 1]
+        else:
+            nxt = "CM_ABORT_ITER("
+        # without a ramp, CM_CONT_0 is the only one and runs the top level
+        run = level if step == 0 else n
+        head = "#define CM_CONT_%d(p, f, ...) " % n
+        out.append(head.ljust(len("#define CM_CONT_%d(p, f, ...) " % level)) +
+                   nxt + "CM_EXECUTE_%d(" % run + call + "))")
+    out.append("")
+
+    for n in range(0, level + 1):
+        head = "#define CM_EXECUTE_%d(x)" % n
+        out.append(head.ljust(len("#define CM_EXECUTE_%d(x)" % level)) +
+                   "  CM_EXEC_%d x" % n)
+
+    if conts[1:]:
+        out.append("")
+    for n in conts[1:]:
+        head = "#define CM_CONTINUE_%d(x)" % n
+        out.append(head.ljust(len("#define CM_CONTINUE_%d(x)" % level)) +
+                   "  CM_CONT_%d x" % n)
+    # CM_CONT_AT_<applications>: CM_CONT_N level the machine moves on to after
+    # that many applications of the transition, as `~, N,` (see CM_STATS)
+    done, marks = 0, []
+    for n, nxt in zip(conts, conts[1:]):
+        done += 1 + exec_iterations(level if step == 0 else n, branch)
+        if done > 999999:
+            break
+        marks.append("#define CM_CONT_AT_%06d ~, %d," % (done, nxt))
+    if marks:
+        out.append("")
+        out.extend(marks)
+    out.append("/* clang-format on */")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("level", nargs="?", type=int,
+                        help="highest CM_EXEC_N/CM_CONT_N level to emit")
+    parser.add_argument("-b", "--branch", type=int, default=2,
+                        help="growth factor per level (default 2)")
+    parser.add_argument("-s", "--step", type=int, default=1,
+                        help="CM_CONT_N step, 0 for no ramp (default 1)")
+    parser.add_argument("--preset", choices=sorted(PRESETS),
+                        help="write a preset ladder into ladder/")
+    parser.add_argument("--list", action="store_true",
+                        help="list presets with their iteration limits")
+    parser.add_argument("--all", action="store_true",
+                        help="regenerate every ladder listed in LEVELS and "
+                        "PRESETS")
+    args = parser.parse_args()
+
+    if args.list:
+        for name in sorted(PRESETS):
+            print("%-8s %-24s %d iterations" %
+                  (name, header_name(*PRESETS[name]),
+                   max_iterations(*PRESETS[name])))
+        return 0
+    if args.all or args.preset:
+        params = [PRESETS[args.preset]] if args.preset else \
+            [(level, 2, 1) for level in LEVELS] + list(PRESETS.values())
+        for level, branch, step in params:
+            path = os.path.join(LADDER_DIR, header_name(level, branch, step))
+            with open(path, "w") as f:
+                f.write(generate(level, branch, step))
+        return 0
+    if args.level is None or args.level < 1:
+        parser.error("level shall be a positive integer")
+    if args.branch < 2 or args.step < 0:
+        parser.error("branching factor shall be at least 2, step at least 0")
+    sys.stdout.write(generate(args.level, args.branch, args.step))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Generates cm_unroll_counts.h, the digits of counts taken by cm_unroll.h.
+
+Usage:
+    tools/gen_unroll_counts.py            # writes cm_unroll_counts.h
+    tools/gen_unroll_counts.py -n 10000   # counts up to 9999
+    tools/gen_unroll_counts.py -o -       # prints it instead
+
+A decimal literal cannot be split into digits by the preprocessor, so
+REPEAT_COUNT(n) of cm_unroll.h pastes it onto REPEAT_N_ and looks the digits
+up here, most significant first, without leading zeros: REPEAT_N_42 expands to
+`(4, 2)`. The parentheses tell a count in the table from any other `n`.
+"""
+import argparse
+import os
+import sys
+
+HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir,
+                      "cm_unroll_counts.h")
+
+
+def generate(limit):
+    out = []
+    out.append("/**")
+    out.append(" * @file cm_unroll_counts.h")
+    out.append(" * @brief Digits of counts 0 ... %d for cm_unroll.h." %
+               (limit - 1))
+    out.append(" *")
+    out.append(" * Generated by tools/gen_unroll_counts.py. Do not edit.")
+    out.append(" */")
+    out.append("#pragma once")
+    out.append("")
+    out.append("/* clang-format off */")
+    for n in range(limit):
+        out.append("#define REPEAT_N_%d (%s)" % (n, ", ".join(str(n))))
+    out.append("/* clang-format on */")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-n", "--limit", type=int, default=1000,
+                        help="number of counts, from 0 (default: 1000)")
+    parser.add_argument("-o", "--output", default=HEADER,
+                        help="output file, - for stdout "
+                        "(default: cm_unroll_counts.h)")
+    args = parser.parse_args()
+    # cm_arith.h numbers have 8 digits
+    if not 1 <= args.limit <= 10 ** 8:
+        parser.error("limit shall be from 1 to 10^8")
+
+    text = generate(args.limit)
+    if args.output == "-":
+        sys.stdout.write(text)
+    else:
+        with open(args.output, "w") as f:
+            f.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
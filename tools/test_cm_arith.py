@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Checks the operations of cm_arith.h against Python's integers.
+
+Usage:
+    tools/test_cm_arith.py [-v]
+
+Every test preprocesses one line per pair of operands and compares the
+numbers it expands to with the expected ones, modulo 10^8.
+"""
+import os
+import random
+import re
+import subprocess
+import unittest
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CC = os.environ.get("CC", "gcc")
+WIDTH = 8
+
+# operands at the edges of the digit width, and around 10^8 / 9, above which
+# the multiples of a divisor no longer fit into it
+EDGES = [0, 1, 9, 10, 99, 12345678, 11111111, 11111112, 20000000, 49999999,
+         50000000, 99999998, 99999999]
+
+
+def arith(n):
+    return "ARITH(%s)" % ", ".join(str(n))
+
+
+def preprocess(lines):
+    source = '#include "cm_arith.h"\n' + "".join(l + "\n" for l in lines)
+    result = subprocess.run([CC, "-E", "-P", "-I", ROOT, "-"], input=source,
+                            capture_output=True, text=True, check=True)
+    return [l for l in result.stdout.splitlines() if l.strip()]
+
+
+class ArithTest(unittest.TestCase):
+    def pairs(self, nonzero=False):
+        rng = random.Random(1)
+        operands = EDGES + [rng.randrange(10 ** k) for k in range(1, 9)]
+        return [(a, b) for a in operands for b in operands
+                if b or not nonzero]
+
+    def check(self, op, expected, nonzero=False, number=True):
+        pairs = self.pairs(nonzero)
+        call = "ARITH_TO_NUMBER(%s)" if number else "%s"
+        lines = [call % ("%s(%s, %s)" % (op, arith(a), arith(b)))
+                 for a, b in pairs]
+        for (a, b), line in zip(pairs, preprocess(lines)):
+            with self.subTest(op=op, a=a, b=b):
+                self.assertEqual(int(re.sub(r"\s", "", line)),
+                                 expected(a, b) % 10 ** WIDTH)
+
+    def test_add(self):
+        self.check("ARITH_ADD", lambda a, b: a + b)
+
+    def test_sub(self):
+        self.check("ARITH_SUB", lambda a, b: a - b)
+
+    def test_mul(self):
+        self.check("ARITH_MUL", lambda a, b: a * b)
+
+    def test_div(self):
+        self.check("ARITH_DIV", lambda a, b: a // b, nonzero=True)
+
+    def test_mod(self):
+        self.check("ARITH_MOD", lambda a, b: a % b, nonzero=True)
+
+    def test_lt(self):
+        self.check("ARITH_LT", lambda a, b: int(a < b), number=False)
+
+
+if __name__ == "__main__":
+    unittest.main()
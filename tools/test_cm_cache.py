@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Checks that tools/cm-cache.py builds the same objects as the compiler.
+
+Usage:
+    tools/test_cm_cache.py [-v]
+
+Every test compiles a source directly and through the wrapper, once filling
+the cache and once from it, and compares the three objects byte for byte.
+Debug information is built without column numbers: tokens of an expansion
+get the column of the call when the compiler expands it, but their own column
+once they are substituted as text.
+"""
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CM_CACHE = os.path.join(ROOT, "tools", "cm-cache.py")
+CC = os.environ.get("CC", "gcc")
+
+SOURCE = r"""#include "continuation_machine.h"
+#define CM_DECLARE(p, f, state, name, ...)                                     \
+  CM_EMIT((int name;), p, IF(IS_EMPTY(__VA_ARGS__))(RETURN, f), state,        \
+          __VA_ARGS__)
+
+CM(DECLARE, CM_NO_STATE, a, b, c)
+
+int main(void) { return a + b + c; }
+"""
+
+
+class ObjectTest(unittest.TestCase):
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+        self.env = dict(os.environ, CM_CACHE_DIR=os.path.join(self.dir,
+                                                              "cache"))
+
+    def tearDown(self):
+        shutil.rmtree(self.dir)
+
+    def build(self, source, obj, flags, wrapped):
+        cmd = [CC, "-I", ROOT] + flags + ["-c", source, "-o", obj]
+        if wrapped:
+            cmd = [sys.executable, CM_CACHE, "--stats", "--"] + cmd
+        result = subprocess.run(cmd, cwd=self.dir, env=self.env,
+                                capture_output=True, text=True)
+        self.assertEqual(result.returncode, 0, result.stderr)
+        with open(os.path.join(self.dir, obj), "rb") as f:
+            return f.read(), result.stderr
+
+    def check(self, source, flags):
+        path = os.path.join(self.dir, source)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "w") as f:
+            f.write(SOURCE)
+        direct, _ = self.build(source, "direct.o", flags, False)
+        miss, stats = self.build(source, "miss.o", flags, True)
+        self.assertIn("0 hits, 1 misses", stats)
+        hit, stats = self.build(source, "hit.o", flags, True)
+        self.assertIn("1 hits, 0 misses", stats)
+        self.assertEqual(miss, direct)
+        self.assertEqual(hit, direct)
+
+    def test_plain(self):
+        self.check("example.c", ["-O2"])
+
+    def test_debug(self):
+        self.check("example.c", ["-g", "-gno-column-info"])
+
+    def test_debug_subdirectory(self):
+        self.check(os.path.join("src", "example.c"),
+                   ["-g", "-gno-column-info"])
+
+
+if __name__ == "__main__":
+    unittest.main()